@@ -3,8 +3,8 @@
  * @file     Interface.c
  * @author   Wyrm
  * @brief    This code is designed to work with various kinds of interfaces. It is a parent class
- * @version  V1.7.4
- * @date     29 Apr. 2026.
+ * @version  V1.26.0
+ * @date     19 Oct. 2026.
 
  *************************************************************************
  */
@@ -20,12 +20,20 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <stdatomic.h>
 
 #include "wheap.h"
 
 #include "Interface.h"
 #include "InterfacePrivate.h"
 #include "InterfacePrivateWrapper.h"
+#include "InterfaceArq.h"
+#include "InterfaceFrag.h"
+#include "InterfaceCompress.h"
+#include "InterfaceDispatch.h"
+#include "InterfaceMpsc.h"
+#include "InterfaceScratch.h"
+#include "InterfaceKeyq.h"
 
 #include "../Interface/CircBuff/CircBuff.h"
 //#include "../Memory/MyHeap/my_heap.h"
@@ -57,8 +65,50 @@
 
 
   static size_t _this_rx_parser(InterfaceHandel_t* cthis,uint8_t* src,size_t len);
-  static void   _this_CmdRxUploadProc(InterfaceHandel_t* cthis);
-  static void   _this_CmdTxUploadProc(InterfaceHandel_t* cthis);
+  static bool   _this_rx_filter(const InterfaceHandel_t* cthis,size_t len);
+  static bool   _this_rx_accept(InterfaceHandel_t* cthis,const sInterfaceAcceptFilter_t* accept,const uint8_t* data,size_t len);
+  static size_t _this_rx_stages(InterfaceHandel_t* cthis,size_t len);
+  static size_t _this_tx_stages(InterfaceHandel_t* cthis,uint8_t** data,size_t len);
+  static void   _this_rx_deliver(InterfaceHandel_t* cthis,uint8_t* data,size_t len);
+  static void   _this_rx_arq_drain(InterfaceHandel_t* cthis);
+  static size_t _this_rx_room(InterfaceHandel_t* cthis);
+  static void   _this_rx_reassembly(InterfaceHandel_t* cthis,uint8_t* data,size_t len);
+  static void   _this_rx_upload(InterfaceHandel_t* cthis,uint8_t* data,size_t len);
+  static inline bool _this_rx_direct(InterfaceHandel_t* cthis);
+  static inline void _this_rx_swap(InterfaceHandel_t* cthis);
+  static void   _this_rx_frame(InterfaceHandel_t* cthis,uint8_t* src,size_t len);
+  static inline void _this_rx_capture(InterfaceHandel_t* cthis,const uint8_t* src,size_t len);
+  static void   _this_reset(InterfaceHandel_t* cthis,HWInterface_t* HwInter);
+  static void   _this_rxq_push(InterfaceHandel_t* cthis,const uint8_t* data,size_t len);
+  static inline bool   _this_rxq_empty(InterfaceHandel_t* cthis);
+  static size_t _this_rxq_pop(InterfaceHandel_t* cthis,uint8_t* dst,uint64_t* ts);
+  static inline void   _this_rx_stamp(InterfaceHandel_t* cthis);
+  static inline void   _this_ts_push(InterfaceHandel_t* cthis);
+  static inline uint64_t _this_ts_pop(InterfaceHandel_t* cthis);
+  static void   _this_rx_residency(InterfaceHandel_t* cthis,uint64_t ts);
+  static inline sCRCInterface_t* _this_rx_crc(const InterfaceHandel_t* cthis);
+  static inline sCRCInterface_t* _this_tx_crc(const InterfaceHandel_t* cthis);
+  static inline AlgoProto _this_rx_unpack(const InterfaceHandel_t* cthis);
+  static inline AlgoProto _this_tx_pack(const InterfaceHandel_t* cthis);
+  static bool   _this_tx_send(InterfaceHandel_t* cthis,const uint8_t* data,size_t leng,const uint32_t* key);
+  static bool   _this_txq_push(InterfaceHandel_t* cthis,const uint8_t* data,size_t leng,const uint32_t* key);
+  static bool   _this_txq_pop(InterfaceHandel_t* cthis,uint8_t* dst,size_t* leng);
+  static inline bool   _this_txq_empty(InterfaceHandel_t* cthis);
+  static inline bool   _this_tx_paced(InterfaceHandel_t* cthis,size_t leng);
+  static uint8_t* _this_tx_mpsc_reserve(InterfaceHandel_t* cthis,size_t leng,bool framing);
+  static bool   _this_tx_mpsc_commit(InterfaceHandel_t* cthis,uint8_t* frame,size_t leng,bool framing);
+  static bool   _this_shaper_ok(InterfaceHandel_t* cthis,size_t leng);
+  static inline void   _this_shaper_charge(InterfaceHandel_t* cthis,size_t leng);
+  static void   _this_release(InterfaceHandel_t* cthis);
+  static void   _this_free_spare(InterfaceHandel_t* cthis,uint8_t** buff,uint8_t** spare);
+  static inline bool _this_pool_owns(const InterfaceHandel_t* cthis,const void* ptr);
+  static inline bool _this_tx_hw(InterfaceHandel_t* cthis,const uint8_t* data,size_t leng);
+  static bool   _this_tx_mpsc(InterfaceHandel_t* cthis,const uint8_t* data,size_t leng,bool framing);
+  static void   _this_tx_mpsc_kick(InterfaceHandel_t* cthis);
+  static void   _this_tx_mpsc_drain(InterfaceHandel_t* cthis);
+  static inline void _this_tx_notify(InterfaceHandel_t* cthis);
+  static bool   _this_CmdRxUploadProc(InterfaceHandel_t* cthis);
+  static bool   _this_CmdTxUploadProc(InterfaceHandel_t* cthis);
   
 /** @}*/ /* Interfafce Private Functions */
 
@@ -72,9 +122,30 @@ struct InterfaceHandel
   AlgoProto   AlgoritmUnpuck;   /*!< Pointer to unpack function*/
 
   sInterfaceRxFilter_t* cFilter;  /*!< Pointer to Riceve Filter Class*/
+  _Atomic(const sInterfaceAcceptFilter_t*) cAccept; /*!< Pointer to acceptance filter, swapped atomically*/
+  uint32_t              AcceptRejected; /*!< Frames rejected by acceptance filter*/
   
 
   sCRCInterface_t*      cCRC;         /*!< Pointer to crc @ref sCRCInterface_t class*/ 
+  uint32_t              HwCaps;       /*!< Driver @ref eHwCaps, read on ctor*/
+  uint32_t              HwRxErrors;   /*!< Frames dropped by driver rx status*/
+
+  InterfaceCompress_t*  cCompress;    /*!< Pointer to compression @ref InterfaceCompress_t class*/
+
+  sInterfaceStage_t     Stages[INTERFACE_MAX_STAGES]; /*!< Pipeline stages*/
+  size_t                StageCnt;     /*!< Number of pipeline stages*/
+  uint8_t*              StageTx[2];   /*!< Tx ping-pong scratch buffers*/
+  size_t                StageTxLen;   /*!< Tx scratch buffer size*/
+  uint8_t*              StageRx;      /*!< Rx scratch buffer, ping-pong with Pack*/
+
+  InterfaceArq_t*       cArq;         /*!< Pointer to reliability layer @ref InterfaceArq_t class*/
+  InterfaceFrag_t*      cFrag;        /*!< Pointer to fragmentation @ref InterfaceFrag_t class*/
+  InterfaceDispatch_t*  cDispatch;    /*!< Pointer to rx dispatch table @ref InterfaceDispatch_t class*/
+  InterfaceMpsc_t*      cMpsc;        /*!< Multi-producer tx queue @ref InterfaceMpsc_t, NULL - single producer*/
+  bool                  MpscInFlight; /*!< Head slot of cMpsc is owned by driver*/
+  atomic_flag           MpscKick;     /*!< Producer side drain guard (irq mode)*/
+  atomic_bool           MpscKickPend; /*!< Kick of a producer that found the guard taken*/
+  sInterfaceNotify_t    TxNotify;     /*!< Frame queued for Interface_process callback*/
 
 
   eInterfaceRxTxHandel_t irqmode;
@@ -87,22 +158,74 @@ struct InterfaceHandel
   uint8_t*  TxBuff;      /*!< Internal Tx Buffer*/
   size_t    Tx_len;     /*!< Internal Tx Buffer len*/
   size_t    TxBuffLen;
+
+  uint8_t*  RxHw;       /*!< Rx buffer owned by driver (== RxBuff if single buffered)*/
+  uint8_t*  TxHw;       /*!< Tx buffer owned by driver (== TxBuff if single buffered)*/
   
-  uint8_t*  Pack;       /*!< Temp pack buffer*/
+  uint8_t*  Pack;       /*!< Temp pack buffer, from cScratch only while parsing if shared*/
+  uint8_t*  PackOwn;    /*!< Own pack buffer, NULL if released for shared scratch*/
+  InterfaceScratch_t* cScratch; /*!< Shared scratch pool @ref InterfaceScratch_t, NULL - own Pack*/
+  size_t    CircDeep;   /*!< Rx/Tx circbuff deep, 0 - no circbuff*/
 
   size_t    LastLeng;   /*!< LastLeng buffer*/
   uint8_t*  CurData;
  
 	CircBuff_t*     CircBuffRx; /*!<Pointer to Tx Circbuff obj*/
 	CircBuff_t*     CircBuffTx; /*!<Pointer to Rx Circbuff obj*/
+  size_t          RxQueued;   /*!< Frames in rx circbuff*/
+
+  InterfaceKeyq_t*        cRxq;         /*!< Rx queue for overflow policies, replaces CircBuffRx, NULL - drop newest*/
+  eInterfaceOverflow_t    RxOverflow;
+  sInterfaceKeyField_t    RxKey;        /*!< Key of kInterfaceOverflow_LatestPerKey*/
+  sInterfaceRxDrops_t     RxDrops;
+  InterfaceKeyq_t*        cTxq;         /*!< Tx conflation queue, replaces CircBuffTx, NULL - off*/
+  sInterfaceKeyField_t    TxKey;        /*!< Tx conflation key*/
+  uint32_t                TxConflated;  /*!< Queued tx frames updated in place*/
+
+  sInterfaceShaper_t      Shaper;       /*!< Tx token bucket, Rate 0 - off*/
+  int64_t                 Tokens;       /*!< Bucket level, 1/1000 byte, negative - debt of oversize frame*/
+  uint32_t                ShaperLast;   /*!< Tick of last refill*/
+  uint8_t*                TxHold;       /*!< Shaper hold buffer, frame popped from tx queue waits here*/
+  size_t                  TxHeldLen;    /*!< Frame in TxHold waiting for tokens or driver, 0 - none*/
+
+  sInterfaceTap_t         Capture;      /*!< Raw rx chunk tap, func NULL - off*/
+
+  sInterfaceTsClock_t     TsClock;      /*!< Rx time stamp clock, func NULL - off*/
+  uint64_t                RxTs;         /*!< Arrival time of frame in process*/
+  uint64_t*               RxTsRing;     /*!< Time stamps parallel to rx circbuff entries*/
+  size_t                  RxTsHead;
+  size_t                  RxTsCount;
+  uint64_t                LateAfter;    /*!< Residency counted as late*/
+  sInterfaceRxResidency_t RxResidency;
   
   HWInterface_t*  HwInter;              /*!< pointer to @ref HWInterface_t*/
   sInterfaceIrqCallback_t hwCB;         /*!< pointer to @ref sInterfaceIrqCallback_t callback from hardware to interface*/
   sInterfaceIrqParentCB_t parentCB;     /*!< pointer to @ref sInterfaceIrqParentCB_t callback from interface to parent*/
 
   bool                    RawMode;
+  bool                    CutThrough;   /*!< process mode: parentCB.RxCb directly while rx circbuff is empty*/
+
+  InterfacePool_t*        Pool;         /*!< Owner pool @ref InterfacePool_t, NULL - heap allocated*/
+};
+
+/**
+ * @brief InterfacePool Class
+ * @details slab of Count slots [class | RxBuff | TxBuff | Pack], free list is a
+ *          Treiber stack of slot indexes, head = index | tag << 16 (ABA guard)
+ */
+struct InterfacePool
+{
+  uint8_t*          Slab;
+  size_t            SlotSize;
+  size_t            Count;
+  size_t            IntBuffSize;
+  uint16_t*         Next;     /*!< free list links*/
+  _Atomic(uint32_t) Head;
 };
 
+#define INTERFACE_POOL_NONE   0xFFFFu  /*!< free list end*/
+#define INTERFACE_POOL_ALIGN(x) (((x)+(sizeof(void*)-1))&~(sizeof(void*)-1))
+
 
 /**
 * @brief InterfaceHandel Class
@@ -118,7 +241,7 @@ InterfaceHandel_t*  Interface_ctor(HWInterface_t* HwInter,size_t IntBuffSize,siz
   if((cthis = heap_malloc_cast(InterfaceHandel_t)) == NULL)
 
     while(1); /* bug catch tag*/
-  cthis->HwInter = HwInter;
+  memset(cthis,0,sizeof(*cthis)); /* dtor is safe on partial construction*/
   
   cthis->RxBuffLen = cthis->TxBuffLen = IntBuffSize;
 
@@ -128,23 +251,15 @@ InterfaceHandel_t*  Interface_ctor(HWInterface_t* HwInter,size_t IntBuffSize,siz
     while(1);
   if((cthis->Pack = heap_malloc(IntBuffSize)) == NULL)
     while(1);
+  cthis->PackOwn = cthis->Pack;
   
   if(CircDeep > 1)
   {
     cthis->CircBuffRx = CircBuff_ctor(IntBuffSize,CircDeep);
-  
-    if(cthis->CircBuffRx == NULL)
-    {
-      CircBuff_dctor(cthis->CircBuffRx);
-      Interface_dtor(cthis);  
-      return NULL;
-    }
-
     cthis->CircBuffTx = CircBuff_ctor(IntBuffSize,CircDeep);
 
-    if(cthis->CircBuffTx == NULL)
+    if((cthis->CircBuffRx == NULL)||(cthis->CircBuffTx == NULL))
     {
-      CircBuff_dctor(cthis->CircBuffTx);
       Interface_dtor(cthis);  
       return NULL;
     }
@@ -154,26 +269,158 @@ InterfaceHandel_t*  Interface_ctor(HWInterface_t* HwInter,size_t IntBuffSize,siz
     cthis->CircBuffRx = cthis->CircBuffTx =NULL;
   }
 
+  cthis->CircDeep = (CircDeep > 1) ? CircDeep : 0;
+  cthis->Pool = NULL;
+
+  _this_reset(cthis,HwInter);
+
+  return cthis;
+}
+
+/**
+ * @brief Set every interface state to default and link buffers to hardware
+ * @note  buffers, circbuffs and Pool must be set before
+ * @param cthis   pointer to @ref InterfaceHandel_t
+ * @param HwInter pointer to abstract Harware interface class @ref HWInterface_t
+ */
+static void _this_reset(InterfaceHandel_t* cthis,HWInterface_t* HwInter)
+{
+  cthis->HwInter = HwInter;
   cthis->irqmode = kInterfaceRxTx_process;
+  cthis->cScratch = NULL;
+  cthis->Pack = cthis->PackOwn;
   
-  memset(cthis->RxBuff,0,IntBuffSize);
+  memset(cthis->RxBuff,0,cthis->RxBuffLen);
   cthis->Rx_len = 0;
 
-  memset(cthis->TxBuff,0,IntBuffSize);
+  memset(cthis->TxBuff,0,cthis->TxBuffLen);
   cthis->Tx_len = 0;
+
+  cthis->LastLeng = 0;
+  cthis->CurData = NULL;
   
   memset(&cthis->parentCB,0,sizeof(cthis->parentCB));
   memset(&cthis->hwCB,0,sizeof(cthis->hwCB));
 
-  HwSetRxBuff(HwInter,cthis->RxBuff,IntBuffSize);
-  HwSetTxBuff(HwInter,cthis->TxBuff,IntBuffSize);
+  cthis->RxHw = cthis->RxBuff;
+  cthis->TxHw = cthis->TxBuff;
+
+  HwSetRxBuff(HwInter,cthis->RxBuff,cthis->RxBuffLen);
+  HwSetTxBuff(HwInter,cthis->TxBuff,cthis->TxBuffLen);
 
   cthis->AlgoritmPack = cthis->AlgoritmUnpuck = NULL;
 
   cthis->cFilter = NULL;
+  atomic_init(&cthis->cAccept,NULL);
+  cthis->AcceptRejected = 0;
   cthis->cCRC = NULL;
+  cthis->HwCaps = HwGetCaps(HwInter);
+  cthis->HwRxErrors = 0;
+  cthis->cCompress = NULL;
+
+  cthis->StageCnt = 0;
+  cthis->StageTx[0] = cthis->StageTx[1] = cthis->StageRx = NULL;
+  cthis->StageTxLen = 0;
+  cthis->cArq = NULL;
+  cthis->cFrag = NULL;
+  cthis->cDispatch = NULL;
+  cthis->cMpsc = NULL;
+  cthis->MpscInFlight = false;
+  atomic_flag_clear(&cthis->MpscKick);
+  atomic_store(&cthis->MpscKickPend,false);
+  memset(&cthis->TxNotify,0,sizeof(cthis->TxNotify));
+
+  cthis->RxQueued = 0;
+  cthis->cRxq = NULL;
+  cthis->RxOverflow = kInterfaceOverflow_DropNewest;
+  memset(&cthis->RxKey,0,sizeof(cthis->RxKey));
+  memset(&cthis->RxDrops,0,sizeof(cthis->RxDrops));
+  cthis->cTxq = NULL;
+  memset(&cthis->TxKey,0,sizeof(cthis->TxKey));
+  cthis->TxConflated = 0;
+  memset(&cthis->Shaper,0,sizeof(cthis->Shaper));
+  cthis->Tokens = 0;
+  cthis->ShaperLast = 0;
+  cthis->TxHold = NULL;
+  cthis->TxHeldLen = 0;
+  memset(&cthis->Capture,0,sizeof(cthis->Capture));
+  memset(&cthis->TsClock,0,sizeof(cthis->TsClock));
+  cthis->RxTs = 0;
+  cthis->RxTsRing = NULL;
+  cthis->RxTsHead = cthis->RxTsCount = 0;
+  cthis->LateAfter = 0;
+  memset(&cthis->RxResidency,0,sizeof(cthis->RxResidency));
+
+  cthis->RawMode = false;
+  cthis->CutThrough = false;
+}
 
-  return cthis;
+/**
+ * @brief Free heap objects linked at run time, keep construction buffers
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ */
+static void _this_release(InterfaceHandel_t* cthis)
+{
+  Interface_ClearStages(cthis);
+
+  _this_free_spare(cthis,&cthis->RxBuff,&cthis->RxHw);
+  _this_free_spare(cthis,&cthis->TxBuff,&cthis->TxHw);
+
+  heap_free(cthis->TxHold);
+  cthis->TxHold    = NULL;
+  cthis->TxHeldLen = 0;
+
+  InterfaceMpsc_dtor(cthis->cMpsc);
+  cthis->cMpsc = NULL;
+
+  InterfaceKeyq_dtor(cthis->cRxq);
+  cthis->cRxq = NULL;
+  InterfaceKeyq_dtor(cthis->cTxq);
+  cthis->cTxq = NULL;
+
+  heap_free(cthis->RxTsRing);
+  cthis->RxTsRing = NULL;
+}
+
+/**
+ * @brief Free double buffer spare, keep the buffer from construction
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @param buff  interface side buffer
+ * @param spare driver side buffer, freed if differs from buff
+ */
+static void _this_free_spare(InterfaceHandel_t* cthis,uint8_t** buff,uint8_t** spare)
+{
+  if(*spare == *buff)
+    return;
+
+  if(_this_pool_owns(cthis,*spare))
+  {
+    uint8_t* slab = *spare; /* buffers were swapped by ping-pong*/
+    *spare = *buff;
+    *buff  = slab;
+  }
+
+  heap_free(*spare);
+  *spare = *buff;
+}
+
+/**
+ * @brief Check memory is in owner pool slab
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @param ptr   memory
+ * @return true   if ptr is in slab
+ * @return false  heap memory or not pooled interface
+ */
+static inline bool _this_pool_owns(const InterfaceHandel_t* cthis,const void* ptr)
+{
+  const InterfacePool_t* pool = cthis->Pool;
+
+  return (pool != NULL)
+       &&((const uint8_t*)ptr >= pool->Slab)
+       &&((const uint8_t*)ptr <  pool->Slab+pool->SlotSize*pool->Count);
 }
 
 /**
@@ -183,14 +430,192 @@ InterfaceHandel_t*  Interface_ctor(HWInterface_t* HwInter,size_t IntBuffSize,siz
  */
 void Interface_dtor(InterfaceHandel_t* cthis)
 {
-  CircBuff_dctor(cthis->CircBuffRx);
-  CircBuff_dctor(cthis->CircBuffTx);
+  if(cthis == NULL)
+    return;
+
+  if(cthis->Pool != NULL)
+  {
+    InterfacePool_Release(cthis->Pool,cthis);
+    return;
+  }
+
+  _this_release(cthis);
+
+  if(cthis->CircBuffRx)
+    CircBuff_dctor(cthis->CircBuffRx);
+  if(cthis->CircBuffTx)
+    CircBuff_dctor(cthis->CircBuffTx);
+
+  if(cthis->RxBuff)
+    heap_free(cthis->RxBuff);
+  if(cthis->TxBuff)
+    heap_free(cthis->TxBuff);
+  if(cthis->PackOwn) /* NULL while shared scratch is used*/
+    heap_free(cthis->PackOwn);
   
   heap_free(cthis);
 
   cthis = NULL;
 }
 
+/**
+ * @brief InterfacePool Class constructor
+ * @details every handle with its buffers lives in one slab, circbuffs are created
+ *          once here, so acquire/release do not call the allocator
+ * @param Count       number of handles (1..65534)
+ * @param IntBuffSize internal buffer size of every handle
+ * @param CircDeep    circbuff deep of every handle (as in @ref Interface_ctor)
+ * @return pointer to allocated pool, NULL if error
+ */
+InterfacePool_t* InterfacePool_ctor(size_t Count,size_t IntBuffSize,size_t CircDeep)
+{
+  if((Count == 0)||(Count >= INTERFACE_POOL_NONE)||(IntBuffSize == 0))
+    return NULL;
+
+  InterfacePool_t* pool = NULL;
+
+  if((pool = heap_malloc_cast(InterfacePool_t)) == NULL)
+    return NULL;
+
+  size_t buff = INTERFACE_POOL_ALIGN(IntBuffSize);
+
+  pool->SlotSize    = INTERFACE_POOL_ALIGN(sizeof(InterfaceHandel_t))+3*buff;
+  pool->Count       = 0;
+  pool->IntBuffSize = IntBuffSize;
+  pool->Slab        = heap_malloc(pool->SlotSize*Count);
+  pool->Next        = heap_malloc(Count*sizeof(uint16_t));
+  atomic_init(&pool->Head,INTERFACE_POOL_NONE);
+
+  if((pool->Slab == NULL)||(pool->Next == NULL))
+  {
+    InterfacePool_dtor(pool);
+    return NULL;
+  }
+
+  for(size_t i = 0; i < Count; i++)
+  {
+    uint8_t*           slot  = pool->Slab+i*pool->SlotSize;
+    InterfaceHandel_t* cthis = (InterfaceHandel_t*)slot;
+
+    memset(cthis,0,sizeof(*cthis));
+    slot += INTERFACE_POOL_ALIGN(sizeof(InterfaceHandel_t));
+
+    cthis->RxBuffLen = cthis->TxBuffLen = IntBuffSize;
+    cthis->RxBuff    = slot;
+    cthis->TxBuff    = slot+buff;
+    cthis->PackOwn   = slot+2*buff;
+    cthis->CircDeep  = (CircDeep > 1) ? CircDeep : 0;
+    cthis->Pool      = pool;
+
+    if(CircDeep > 1)
+    {
+      cthis->CircBuffRx = CircBuff_ctor(IntBuffSize,CircDeep);
+      cthis->CircBuffTx = CircBuff_ctor(IntBuffSize,CircDeep);
+    }
+    pool->Count++; /* dtor frees circbuffs of counted slots*/
+
+    if((CircDeep > 1)&&((cthis->CircBuffRx == NULL)||(cthis->CircBuffTx == NULL)))
+    {
+      InterfacePool_dtor(pool);
+      return NULL;
+    }
+
+    pool->Next[i] = (i+1 < Count) ? (uint16_t)(i+1) : INTERFACE_POOL_NONE;
+  }
+  atomic_store_explicit(&pool->Head,0,memory_order_release);
+
+  return pool;
+}
+
+/**
+ * @brief InterfacePool class destructor
+ * @note  every handle must be released before
+ * @param pool pointer to @ref InterfacePool_t
+ */
+void InterfacePool_dtor(InterfacePool_t* pool)
+{
+  if(pool == NULL)
+    return;
+
+  for(size_t i = 0; i < pool->Count; i++)
+  {
+    InterfaceHandel_t* cthis = (InterfaceHandel_t*)(pool->Slab+i*pool->SlotSize);
+
+    if(cthis->CircBuffRx)
+      CircBuff_dctor(cthis->CircBuffRx);
+    if(cthis->CircBuffTx)
+      CircBuff_dctor(cthis->CircBuffTx);
+  }
+
+  if(pool->Slab)
+    heap_free(pool->Slab);
+  if(pool->Next)
+    heap_free(pool->Next);
+  heap_free(pool);
+}
+
+/**
+ * @brief Take handle from pool (lock-free, O(1))
+ * 
+ * @param pool    pointer to @ref InterfacePool_t
+ * @param HwInter pointer to abstract Harware interface class @ref HWInterface_t
+ * @return InterfaceHandel_t* handle in default state, NULL if pool is empty
+ */
+InterfaceHandel_t* InterfacePool_Acquire(InterfacePool_t* pool,HWInterface_t* HwInter)
+{
+  if((pool == NULL)||(HwInter == NULL))
+    return NULL;
+
+  uint32_t head = atomic_load_explicit(&pool->Head,memory_order_acquire);
+  uint32_t idx;
+
+  do
+  {
+    if((idx = head & 0xFFFFu) == INTERFACE_POOL_NONE)
+      return NULL;
+  }while(!atomic_compare_exchange_weak_explicit(&pool->Head,&head,
+                                                 pool->Next[idx]|((head+0x10000u)&0xFFFF0000u),
+                                                 memory_order_acquire,memory_order_acquire));
+
+  InterfaceHandel_t* cthis = (InterfaceHandel_t*)(pool->Slab+idx*pool->SlotSize);
+
+  _this_reset(cthis,HwInter);
+
+  return cthis;
+}
+
+/**
+ * @brief Give handle back to pool (lock-free, O(1) + circbuff drain)
+ * @details objects linked at run time (stages, double buffers, multi-producer queue)
+ *          are freed, queued frames are dropped. @ref Interface_dtor does the same
+ * @param pool  pointer to @ref InterfacePool_t
+ * @param cthis handle from @ref InterfacePool_Acquire
+ */
+void InterfacePool_Release(InterfacePool_t* pool,InterfaceHandel_t* cthis)
+{
+  if((pool == NULL)||(cthis == NULL)||(cthis->Pool != pool))
+    return;
+
+  _this_release(cthis);
+
+  size_t leng = 0;
+
+  if(cthis->CircBuffRx)
+    while(CircBuff_pop(cthis->CircBuffRx,cthis->RxBuff,&leng));
+  if(cthis->CircBuffTx)
+    while(CircBuff_pop(cthis->CircBuffTx,cthis->TxBuff,&leng));
+
+  uint16_t idx  = (uint16_t)(((uint8_t*)cthis-pool->Slab)/pool->SlotSize);
+  uint32_t head = atomic_load_explicit(&pool->Head,memory_order_relaxed);
+
+  do
+  {
+    pool->Next[idx] = (uint16_t)(head & 0xFFFFu);
+  }while(!atomic_compare_exchange_weak_explicit(&pool->Head,&head,
+                                                 idx|((head+0x10000u)&0xFFFF0000u),
+                                                 memory_order_release,memory_order_relaxed));
+}
+
 /**
  * @brief Set Intereface irq mode
  * 
@@ -224,6 +649,289 @@ void   Interface_SetMode(InterfaceHandel_t* cthis,const eInterfaceRxTxHandel_t m
 void  Interface_SetRawMode(InterfaceHandel_t* cthis,bool state) {cthis->RawMode = state;}
 
 bool  Interface_isRawMode(InterfaceHandel_t* cthis) {return cthis->RawMode;}
+
+/**
+ * @brief Set ping-pong (double buffered) Rx and Tx hardware buffers
+ * @details Ownership handoff with the driver:
+ *          - Rx: rx_cb(data) passes the filled buffer to the interface, the interface
+ *            links the other one by SetRxBuff() before parsing, so DMA goes on
+ *          - Tx: SendData(TxBuff) passes the buffer to the driver until tx_cb,
+ *            the next frame is packed into the other one meanwhile
+ * @note  call before Connect, disable frees the second buffers
+ * @param cthis pointer to @ref InterfaceHandel
+ * @param state true - enable
+ * @return true   if set
+ * @return false  no memory, buffers left single
+ */
+bool  Interface_SetDoubleBuffer(InterfaceHandel_t* cthis,bool state)
+{
+  if(state)
+  {
+    if(cthis->RxHw == cthis->RxBuff)
+    {
+      if((cthis->RxHw = heap_malloc(cthis->RxBuffLen)) == NULL)
+      {
+        cthis->RxHw = cthis->RxBuff;
+        return false;
+      }
+    }
+    if(cthis->TxHw == cthis->TxBuff)
+    {
+      if((cthis->TxHw = heap_malloc(cthis->TxBuffLen)) == NULL)
+      {
+        cthis->TxHw = cthis->TxBuff;
+        _this_free_spare(cthis,&cthis->RxBuff,&cthis->RxHw); /* all or nothing*/
+        return false;
+      }
+    }
+    HwSetRxBuff(cthis->HwInter,cthis->RxHw,cthis->RxBuffLen);
+  }
+  else
+  {
+    _this_free_spare(cthis,&cthis->RxBuff,&cthis->RxHw);
+    _this_free_spare(cthis,&cthis->TxBuff,&cthis->TxHw);
+    HwSetRxBuff(cthis->HwInter,cthis->RxBuff,cthis->RxBuffLen);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Set multi-producer send mode
+ * @details every Interface_SendData/Interface_Send_cu8 caller frames into its own
+ *          slot of a lock-free queue, frames go to driver in reservation order
+ *          straight from the slots. Slot is 2 x IntBuffSize (payload + packed frame)
+ * @note  call before any send. Pipeline stages and compression keep per-interface
+ *        state, send fails while they are installed
+ * @param cthis pointer to @ref InterfaceHandel
+ * @param deep  number of slots, 0 - back to single producer mode
+ * @return true   if set
+ * @return false  no memory
+ */
+bool  Interface_SetMultiProducer(InterfaceHandel_t* cthis,size_t deep)
+{
+  InterfaceMpsc_dtor(cthis->cMpsc);
+  cthis->cMpsc = NULL;
+  cthis->MpscInFlight = false;
+
+  if(deep == 0)
+    return true;
+
+  return (cthis->cMpsc = InterfaceMpsc_ctor(2*cthis->TxBuffLen,deep)) != NULL;
+}
+
+/**
+ * @brief Use shared scratch pool instead of own Pack buffer
+ * @details own Pack buffer (IntBuffSize) is freed, a pool buffer is taken only
+ *          while a frame is parsed
+ * @note  call before Connect, pool must live longer than interface
+ * @param cthis pointer to @ref InterfaceHandel
+ * @param pool  pointer to @ref InterfaceScratch_t, NULL - back to own Pack buffer
+ * @return true   if set
+ * @return false  pool buffer is smaller than IntBuffSize or no memory
+ */
+bool  Interface_SetScratch(InterfaceHandel_t* cthis,InterfaceScratch_t* pool)
+{
+  if(pool == NULL)
+  {
+    if((cthis->PackOwn == NULL)&&((cthis->PackOwn = heap_malloc(cthis->RxBuffLen)) == NULL))
+      return false;
+    cthis->Pack     = cthis->PackOwn;
+    cthis->cScratch = NULL;
+    return true;
+  }
+
+  if(InterfaceScratch_GetSize(pool) < cthis->RxBuffLen)
+    return false;
+
+  if(cthis->Pool == NULL) /* pooled handle keeps its slab Pack*/
+  {
+    heap_free(cthis->PackOwn);
+    cthis->PackOwn = NULL;
+  }
+  cthis->Pack     = NULL;
+  cthis->cScratch = pool;
+
+  return true;
+}
+
+/**
+ * @brief Get memory used by interface instance
+ * 
+ * @param[in]  cthis pointer to @ref InterfaceHandel
+ * @param[out] fp    pointer to @ref sInterfaceFootprint_t
+ */
+void  Interface_GetFootprint(InterfaceHandel_t* cthis,sInterfaceFootprint_t* fp)
+{
+  fp->Handle  = sizeof(*cthis);
+
+  fp->Buffers = cthis->RxBuffLen+cthis->TxBuffLen;
+  if(cthis->PackOwn != NULL)
+    fp->Buffers += cthis->RxBuffLen;
+  if(cthis->RxHw != cthis->RxBuff)
+    fp->Buffers += cthis->RxBuffLen;
+  if(cthis->TxHw != cthis->TxBuff)
+    fp->Buffers += cthis->TxBuffLen;
+  if(cthis->TxHold != NULL)
+    fp->Buffers += cthis->TxBuffLen;
+
+  fp->Queues  = cthis->CircDeep*(cthis->RxBuffLen+cthis->TxBuffLen);
+  if(cthis->cMpsc != NULL)
+    fp->Queues += InterfaceMpsc_GetFootprint(cthis->cMpsc);
+  if(cthis->cRxq != NULL)
+    fp->Queues += InterfaceKeyq_GetFootprint(cthis->cRxq);
+  if(cthis->cTxq != NULL)
+    fp->Queues += InterfaceKeyq_GetFootprint(cthis->cTxq);
+  if(cthis->RxTsRing != NULL)
+    fp->Queues += cthis->CircDeep*sizeof(uint64_t);
+
+  fp->Stages  = 2*cthis->StageTxLen;
+  if(cthis->StageRx != NULL)
+    fp->Stages += cthis->RxBuffLen;
+
+  fp->Total   = fp->Handle+fp->Buffers+fp->Queues+fp->Stages;
+}
+
+/**
+ * @brief Set rx queue overflow policy
+ * @details drop newest uses rx circbuff, other policies use own keyed queue of the
+ *          same deep, frames already in rx circbuff are read first
+ * @note  needs CircDeep > 1, in irq mode call with rx disabled
+ * @param cthis   pointer to @ref InterfaceHandel
+ * @param policy  @ref eInterfaceOverflow_t
+ * @param key     frame key position, only for kInterfaceOverflow_LatestPerKey
+ * @return true   if policy set
+ * @return false  no rx queue, bad key or no memory
+ */
+bool  Interface_SetRxOverflow(InterfaceHandel_t* cthis,eInterfaceOverflow_t policy,const sInterfaceKeyField_t* key)
+{
+  if(cthis->CircBuffRx == NULL)
+    return false;
+
+  if(policy == kInterfaceOverflow_LatestPerKey)
+  {
+    if((key == NULL)||(key->Width == 0)||(key->Width > 4))
+      return false;
+    cthis->RxKey = *key;
+  }
+
+  if(policy == kInterfaceOverflow_DropNewest)
+  {
+    InterfaceKeyq_dtor(cthis->cRxq);
+    cthis->cRxq = NULL;
+  }
+  else if(cthis->cRxq == NULL)
+  {
+    if((cthis->cRxq = InterfaceKeyq_ctor(cthis->RxBuffLen,cthis->CircDeep)) == NULL)
+      return false;
+  }
+  else if(policy == kInterfaceOverflow_LatestPerKey)
+    InterfaceKeyq_Clear(cthis->cRxq); /* queued keys may belong to the old key field*/
+
+  cthis->RxOverflow = policy;
+
+  return true;
+}
+
+/**
+ * @brief Get rx queue drop counters
+ * 
+ * @param[in]  cthis pointer to @ref InterfaceHandel
+ * @param[out] drops pointer to @ref sInterfaceRxDrops_t
+ */
+void  Interface_GetRxDrops(InterfaceHandel_t* cthis,sInterfaceRxDrops_t* drops) {*drops = cthis->RxDrops;}
+
+/**
+ * @brief Set tx conflation
+ * @details a frame queued while an older frame of the same key is still unsent
+ *          replaces that frame in place (keeps its place in the line). Key is read
+ *          from payload before stages/pack (raw frame for Interface_Send_cu8).
+ *          Conflation queue has deep of tx circbuff and replaces it, frames already
+ *          in tx circbuff are sent first
+ * @note  needs CircDeep > 1, not with multi-producer mode. In irq mode call with tx idle
+ * @param cthis pointer to @ref InterfaceHandel
+ * @param key   key position, NULL - off
+ * @return true   if set
+ * @return false  no tx queue, bad key or no memory
+ */
+bool  Interface_SetTxConflation(InterfaceHandel_t* cthis,const sInterfaceKeyField_t* key)
+{
+  if(key == NULL)
+  {
+    InterfaceKeyq_dtor(cthis->cTxq);
+    cthis->cTxq = NULL;
+    return true;
+  }
+
+  if((cthis->CircBuffTx == NULL)||(key->Width == 0)||(key->Width > 4))
+    return false;
+
+  if(cthis->cTxq == NULL)
+  {
+    if((cthis->cTxq = InterfaceKeyq_ctor(cthis->TxBuffLen,cthis->CircDeep)) == NULL)
+      return false;
+  }
+  else
+    InterfaceKeyq_Clear(cthis->cTxq);
+
+  cthis->TxKey = *key;
+
+  return true;
+}
+
+/**
+ * @brief Get number of tx frames updated in place by conflation
+ * 
+ * @param cthis pointer to @ref InterfaceHandel
+ * @return uint32_t conflated frames
+ */
+uint32_t  Interface_GetTxConflated(InterfaceHandel_t* cthis) {return cthis->TxConflated;}
+
+/**
+ * @brief Set tx token bucket shaper
+ * @details bucket fills with Rate bytes per 1000 clock ticks up to Burst bytes, every
+ *          frame sent to driver takes its size. A frame is passed to driver when the
+ *          bucket holds its size (or is full for frames bigger than Burst), otherwise
+ *          it waits in tx queue. Queued frame is popped once to a hold buffer of
+ *          its own (TxBuff stays free for packing) and held until tokens
+ * @note  process mode only, Interface_process is the pacing point.
+ *        Bucket starts full
+ * @note  hold buffer is allocated on first enable and kept until dtor
+ * @param cthis   pointer to @ref InterfaceHandel
+ * @param shaper  pointer to @ref sInterfaceShaper_t, NULL - off
+ * @return true   if set
+ * @return false  irq mode, no clock or zero Burst
+ */
+bool  Interface_SetShaper(InterfaceHandel_t* cthis,const sInterfaceShaper_t* shaper)
+{
+  if(shaper == NULL)
+  {
+    cthis->Shaper.Rate = 0;
+    return true;
+  }
+
+  if((cthis->irqmode == kInterfaceRxTx_irq)||(shaper->Clock.func == NULL)||(shaper->Burst == 0))
+    return false;
+
+  if((cthis->TxHold == NULL)&&((cthis->TxHold = heap_malloc(cthis->TxBuffLen)) == NULL))
+    return false;
+
+  cthis->Shaper     = *shaper;
+  cthis->Tokens     = (int64_t)shaper->Burst*1000;
+  cthis->ShaperLast = shaper->Clock.func(shaper->Clock.parent);
+
+  return true;
+}
+
+/**
+ * @brief Set cut-through rx delivery for process mode
+ * @note  if parentCB.RxCb is set and rx circbuff is empty the frame goes straight from
+ *        the internal buffer to the callback, otherwise it is queued (order is kept).
+ *        data pointer is valid only inside the callback
+ * @param cthis pointer to @ref InterfaceHandel
+ * @param state true - enable
+ */
+void  Interface_SetCutThrough(InterfaceHandel_t* cthis,bool state) {cthis->CutThrough = state;}
 /**
  * @brief Get Interface max data length
  * 
@@ -234,7 +942,7 @@ size_t    Interface_GetMaxDatalng(InterfaceHandel_t* cthis) {return HwGetMaxData
 
 /**
  * @brief Sets pack and unpack algoritm 
- * 
+ * @note  not run if driver delimits frames (@ref kHwCap_Framed)
  * @param cthis pointer to @ref InterfaceHandel
  * @param pack  pointer to pack @ref AlgoProto function
  * @param unpack pointer to unpack @ref AlgoProto functiono
@@ -254,6 +962,8 @@ void Interface_InstallProtoAlgoritm(InterfaceHandel_t* cthis,AlgoProto pack, Alg
 
 /**
  * @brief Link CRC algoritm function to @ref InterfaceHandel
+ * @note  direction done by driver (@ref kHwCap_RxCrc, @ref kHwCap_TxCrc) is skipped,
+ *        the other one stays in software
  * @param cthis pointer to @ref InterfaceHandel_t 
  * @param crcf pointer to CRC @ref AlgoCrc algoritm func
  * @param CrcHeadCalc true if need calculate crc for head, false for calculate only payload
@@ -287,8 +997,184 @@ bool Interface_InstallFilter(InterfaceHandel_t* cthis, sInterfaceRxFilter_t *fil
   return true;
 }
 /**
- * @brief set parent callback function for fast call in irq
- * 
+ * @brief Set acceptance filter
+ * @details pointer is swapped atomically, so it can be called while rx irq is running.
+ *          Previous table can be reused once the frame being parsed is done
+ * @param cthis  pointer to @ref InterfaceHandel_t 
+ * @param filter pointer to @ref sInterfaceAcceptFilter_t, NULL to accept everything
+ * @return const sInterfaceAcceptFilter_t* previous filter
+ */
+const sInterfaceAcceptFilter_t* Interface_SetAcceptFilter(InterfaceHandel_t* cthis,const sInterfaceAcceptFilter_t* filter)
+{
+  if(cthis == NULL)
+    return NULL;
+
+  return atomic_exchange_explicit(&cthis->cAccept,filter,memory_order_acq_rel);
+}
+
+/**
+ * @brief Get number of frames rejected by acceptance filter
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t 
+ * @return uint32_t rejected frames
+ */
+uint32_t Interface_GetAcceptRejected(InterfaceHandel_t* cthis) {return cthis->AcceptRejected;}
+
+/**
+ * @brief Get number of frames dropped by driver rx status (hardware crc or framing error)
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @return uint32_t dropped frames
+ */
+uint32_t Interface_GetHwRxErrors(InterfaceHandel_t* cthis) {return cthis->HwRxErrors;}
+
+/**
+ * @brief installation compression class to interface
+ * @details payload is compressed before pipeline stages, crc and pack, and
+ *          decompressed after unpack, crc check and stages. Rx filter is applied
+ *          to decompressed data
+ * @param cthis pointer to @ref InterfaceHandel_t 
+ * @param comp  pointer to @ref InterfaceCompress_t class, NULL to remove
+ * @return true   if class install
+ * @return false  error
+ */
+bool Interface_InstallCompress(InterfaceHandel_t* cthis,InterfaceCompress_t* comp)
+{
+  if(cthis == NULL)
+    return false;
+  
+  cthis->cCompress = comp;
+
+  return true;
+}
+
+/**
+ * @brief Append stage to interface pipeline
+ * @details scratch buffers are (re)allocated here to fit accumulated overhead,
+ *          so frame path never allocates
+ * @param cthis pointer to @ref InterfaceHandel_t 
+ * @param stage pointer to @ref sInterfaceStage_t, copied
+ * @return true   if stage added
+ * @return false  error or no free stage slot
+ */
+bool Interface_AddStage(InterfaceHandel_t* cthis,const sInterfaceStage_t* stage)
+{
+  if((cthis == NULL)||(stage == NULL)||(cthis->StageCnt >= INTERFACE_MAX_STAGES))
+    return false;
+
+  size_t overhead = stage->Overhead;
+
+  for(size_t i = 0;i<cthis->StageCnt;i++)
+    overhead += cthis->Stages[i].Overhead;
+
+  /* first stage may get a frame grown by compression flag*/
+  size_t   tx_len = cthis->TxBuffLen+INTERFACE_COMPRESS_HEAD_SIZE+overhead+INTERFACE_CRC_SPARE;
+  uint8_t* tx0    = heap_malloc(tx_len);
+  uint8_t* tx1    = heap_malloc(tx_len);
+  uint8_t* rx     = (cthis->StageRx != NULL) ? cthis->StageRx : heap_malloc(cthis->RxBuffLen);
+
+  if((tx0 == NULL)||(tx1 == NULL)||(rx == NULL))
+  {
+    heap_free(tx0);
+    heap_free(tx1);
+    if(rx != cthis->StageRx)
+      heap_free(rx);
+    return false;
+  }
+
+  heap_free(cthis->StageTx[0]);
+  heap_free(cthis->StageTx[1]);
+
+  cthis->StageTx[0] = tx0;
+  cthis->StageTx[1] = tx1;
+  cthis->StageTxLen = tx_len;
+  cthis->StageRx    = rx;
+
+  cthis->Stages[cthis->StageCnt++] = *stage;
+
+  return true;
+}
+
+/**
+ * @brief Remove every pipeline stage and free scratch buffers
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t 
+ */
+void Interface_ClearStages(InterfaceHandel_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  cthis->StageCnt = 0;
+
+  heap_free(cthis->StageTx[0]);
+  heap_free(cthis->StageTx[1]);
+  heap_free(cthis->StageRx);
+
+  cthis->StageTx[0] = cthis->StageTx[1] = cthis->StageRx = NULL;
+  cthis->StageTxLen = 0;
+}
+
+/**
+ * @brief installation reliability layer to interface
+ * @details every valid frame goes through @ref InterfaceArq_Input, in order payloads
+ *          are delivered to parent callback or rx buffer as usual
+ * @param cthis pointer to @ref InterfaceHandel_t 
+ * @param arq   pointer to @ref InterfaceArq_t class, NULL to remove
+ * @return true   if layer install
+ * @return false  error
+ */
+bool Interface_InstallArq(InterfaceHandel_t* cthis,InterfaceArq_t* arq)
+{
+  if(cthis == NULL)
+    return false;
+  
+  cthis->cArq = arq;
+
+  return true;
+}
+
+/**
+ * @brief installation fragmentation class to interface
+ * @details every valid frame (after reliability layer if installed) goes through
+ *          @ref InterfaceFrag_Input, complete messages are delivered as usual
+ * @param cthis pointer to @ref InterfaceHandel_t 
+ * @param frag  pointer to @ref InterfaceFrag_t class, NULL to remove
+ * @return true   if class install
+ * @return false  error
+ */
+bool Interface_InstallFrag(InterfaceHandel_t* cthis,InterfaceFrag_t* frag)
+{
+  if(cthis == NULL)
+    return false;
+  
+  cthis->cFrag = frag;
+
+  return true;
+}
+
+/**
+ * @brief installation rx dispatch table to interface
+ * @details frames with registered key go to their handler in both irq and process
+ *          mode, other frames go to parent callback or rx circbuff as usual
+ * @param cthis     pointer to @ref InterfaceHandel_t 
+ * @param dispatch  pointer to @ref InterfaceDispatch_t class, NULL to remove
+ * @return true   if table install
+ * @return false  error
+ */
+bool Interface_InstallDispatch(InterfaceHandel_t* cthis,InterfaceDispatch_t* dispatch)
+{
+  if(cthis == NULL)
+    return false;
+  
+  cthis->cDispatch = dispatch;
+
+  return true;
+}
+
+/**
+ * @brief set parent callback function for fast call in irq
+ * 
  * @param cthis     pointer to @ref InterfaceHandel_t 
  * @param parentCB  pointer to Interface irq parent callback struct @ref sInterfaceIrqParentCB_t
  * @return true     if set successful
@@ -318,169 +1204,1047 @@ bool Interface_SetCB(InterfaceHandel_t* cthis, sInterfaceIrqParentCB_t* parentCB
  */
 static void _this_rx_irq(void* cthis,uint8_t* src,size_t len)
 {
-  if(cthis == NULL) 
-    return;
+  if(cthis == NULL) 
+    return;
+
+  if((CAST_INTERFACE(cthis)->RxHw != CAST_INTERFACE(cthis)->RxBuff)&&(src == CAST_INTERFACE(cthis)->RxHw))
+    _this_rx_swap(CAST_INTERFACE(cthis));
+
+  _this_rx_stamp(CAST_INTERFACE(cthis));
+  _this_rx_capture(CAST_INTERFACE(cthis),src,len);
+
+  _this_rx_frame(CAST_INTERFACE(cthis),src,len);
+}
+
+/**
+ * @brief Pass raw driver chunk to capture tap
+ * 
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ * @param[in] src   raw chunk
+ * @param[in] len   chunk leng 
+ */
+static inline void _this_rx_capture(InterfaceHandel_t* cthis,const uint8_t* src,size_t len)
+{
+  if(cthis->Capture.func != NULL)
+    cthis->Capture.func(cthis->Capture.parent,src,len);
+}
+
+/**
+ * @brief Parse and deliver one received frame
+ * @details Pack buffer is taken from shared scratch pool for the time of the call
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ * @param[in] src   raw frame
+ * @param[in] len   raw frame leng 
+ */
+static void _this_rx_frame(InterfaceHandel_t* cthis,uint8_t* src,size_t len)
+{
+  if((cthis->cScratch != NULL)&&((cthis->Pack = InterfaceScratch_Acquire(cthis->cScratch)) == NULL))
+    return; /* pool is empty, frame dropped*/
+
+  if((cthis->LastLeng = _this_rx_parser(cthis,src,len)) != 0)
+    _this_rx_deliver(cthis,cthis->CurData,cthis->LastLeng);
+
+  if(cthis->cScratch != NULL)
+  {
+    InterfaceScratch_Release(cthis->cScratch,cthis->Pack);
+    cthis->Pack = NULL;
+  }
+}
+
+/**
+ * @brief Take filled Rx buffer from driver and link the free one
+ * 
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ */
+static inline void _this_rx_swap(InterfaceHandel_t* cthis)
+{
+  uint8_t* filled = cthis->RxHw;
+
+  cthis->RxHw   = cthis->RxBuff;
+  cthis->RxBuff = filled;
+  HwSetRxBuff(cthis->HwInter,cthis->RxHw,cthis->RxBuffLen);
+}
+
+/**
+ * @brief Deliver parsed frame to upper layer
+ * @details frame passes through reliability layer if installed
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ * @param[in] data  parsed data
+ * @param[in] len   data leng 
+ */
+static void _this_rx_deliver(InterfaceHandel_t* cthis,uint8_t* data,size_t len)
+{
+  if(cthis->cArq == NULL)
+  {
+    _this_rx_reassembly(cthis,data,len);
+    return;
+  }
+
+  InterfaceArq_SetRxRoom(cthis->cArq,_this_rx_room(cthis)); /* ack sent by input advertises it*/
+
+  if(InterfaceArq_Input(cthis->cArq,data,len))
+    _this_rx_arq_drain(cthis);
+}
+
+/**
+ * @brief Take in order frames from reliability layer while rx queue has room
+ * @details acked frame must not be dropped by full queue, it waits in the
+ *          receive window and the peer is told the room left
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ */
+static void _this_rx_arq_drain(InterfaceHandel_t* cthis)
+{
+  uint8_t* payload = NULL;
+  size_t   len;
+
+  while((_this_rx_room(cthis) != 0)&&((len = InterfaceArq_Pop(cthis->cArq,&payload)) != 0))
+    _this_rx_reassembly(cthis,payload,len);
+
+  InterfaceArq_SetRxRoom(cthis->cArq,_this_rx_room(cthis));
+}
+
+/**
+ * @brief Get number of frames rx queue can take without dropping one
+ * @note  overwrite policies drop old frames by choice, they are not limited
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ * @return size_t free frames, SIZE_MAX - frames are not queued or not dropped
+ */
+static size_t _this_rx_room(InterfaceHandel_t* cthis)
+{
+  if((cthis->CircBuffRx == NULL)||(cthis->cRxq != NULL)||_this_rx_direct(cthis))
+    return SIZE_MAX;
+  if((cthis->cFrag != NULL)&&InterfaceFrag_IsRxDirect(cthis->cFrag))
+    return SIZE_MAX;
+
+  return cthis->CircDeep-cthis->RxQueued;
+}
+
+/**
+ * @brief Pass frame through fragment reassembly if installed
+ * 
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ * @param[in] data  frame data
+ * @param[in] len   data leng 
+ */
+static void _this_rx_reassembly(InterfaceHandel_t* cthis,uint8_t* data,size_t len)
+{
+  if(cthis->cFrag == NULL)
+  {
+    _this_rx_upload(cthis,data,len);
+    return;
+  }
+
+  if(!InterfaceFrag_Input(cthis->cFrag,data,len))
+    return;
+
+  if((len = InterfaceFrag_Pop(cthis->cFrag,&data)) != 0)
+    _this_rx_upload(cthis,data,len);
+}
+
+/**
+ * @brief Upload frame to dispatch table handler, parent callback (irq mode) or rx circbuff
+ * 
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ * @param[in] data  frame data
+ * @param[in] len   data leng 
+ */
+static void _this_rx_upload(InterfaceHandel_t* cthis,uint8_t* data,size_t len)
+{
+  if((cthis->cDispatch != NULL)&&InterfaceDispatch_Route(cthis->cDispatch,cthis,data,len))
+    return;
+
+  if(_this_rx_direct(cthis))
+    cthis->parentCB.RxCb(cthis->parentCB.parent,cthis,data,len);
+  else
+    _this_rxq_push(cthis,data,len);
+}
+
+/**
+ * @brief Check frame could bypass rx circbuff
+ * 
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ * @return true   irq mode with parent callback, or process mode cut-through with empty circbuff
+ * @return false  frame should be queued
+ */
+static inline bool _this_rx_direct(InterfaceHandel_t* cthis)
+{
+  if(cthis->parentCB.RxCb == NULL)
+    return false;
+
+  if(cthis->irqmode == kInterfaceRxTx_irq)
+    return true;
+
+  return cthis->CutThrough && _this_rxq_empty(cthis);
+}
+
+/**
+ * @brief Queue received frame by overflow policy
+ * 
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ * @param[in] data  frame data
+ * @param[in] len   data leng 
+ */
+static void _this_rxq_push(InterfaceHandel_t* cthis,const uint8_t* data,size_t len)
+{
+  if(cthis->cRxq == NULL)
+  {
+    if(cthis->CircBuffRx == NULL)
+      return;
+
+    if(CircBuff_push(cthis->CircBuffRx,(uint8_t*)data,len))
+    {
+      cthis->RxQueued++;
+      _this_ts_push(cthis);
+    }
+    else
+      cthis->RxDrops.Dropped++;
+    return;
+  }
+
+  uint32_t key   = 0;
+  bool     keyed = (cthis->RxOverflow == kInterfaceOverflow_LatestPerKey)
+                 &&Interface_GetKey(&cthis->RxKey,data,len,&key);
+
+  switch(InterfaceKeyq_PushTag(cthis->cRxq,data,len,keyed ? &key : NULL,true,cthis->RxTs))
+  {
+    case kInterfaceKeyq_Replace:  cthis->RxDrops.Replaced++;    break;
+    case kInterfaceKeyq_Evict:    cthis->RxDrops.Overwritten++; break;
+    case kInterfaceKeyq_Append:                                 break;
+    default:                      cthis->RxDrops.Dropped++;     break;
+  }
+}
+
+/**
+ * @brief Check rx queue is empty
+ * 
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ * @return true   if nothing queued (or no queue)
+ * @return false  else
+ */
+static inline bool _this_rxq_empty(InterfaceHandel_t* cthis)
+{
+  if(cthis->CircBuffRx == NULL)
+    return true;
+
+  return CircBuff_IsFree(cthis->CircBuffRx)&&((cthis->cRxq == NULL)||InterfaceKeyq_IsEmpty(cthis->cRxq));
+}
+
+/**
+ * @brief Take oldest frame from rx queue
+ * 
+ * @param[in]  cthis pointer to @ref InterfaceHandel_t 
+ * @param[out] dst   output buffer
+ * @param[out] ts    arrival time stamp of frame, 0 - time stamps off
+ * @return size_t frame leng, 0 - empty
+ */
+static size_t _this_rxq_pop(InterfaceHandel_t* cthis,uint8_t* dst,uint64_t* ts)
+{
+  size_t leng = 0;
+
+  /* frames queued before policy change go first*/
+  if(CircBuff_pop(cthis->CircBuffRx,dst,&leng))
+  {
+    cthis->RxQueued--;
+    *ts = _this_ts_pop(cthis);
+  }
+  else if(cthis->cRxq != NULL)
+  {
+    *ts = InterfaceKeyq_HeadTag(cthis->cRxq);
+    if(!InterfaceKeyq_Pop(cthis->cRxq,dst,&leng))
+      leng = 0;
+  }
+
+  return leng;
+}
+
+/**
+ * @brief Take arrival time of frame in process, driver stamp first, else clock
+ * @note  called right after driver returned the chunk (rx irq entry or ReadRxBuff)
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ */
+static inline void _this_rx_stamp(InterfaceHandel_t* cthis)
+{
+  if(cthis->TsClock.func == NULL)
+    return;
+
+  if(!HwGetRxTs(cthis->HwInter,&cthis->RxTs))
+    cthis->RxTs = cthis->TsClock.func(cthis->TsClock.parent);
+}
+
+/**
+ * @brief Keep time stamp of frame pushed to rx circbuff
+ * 
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ */
+static inline void _this_ts_push(InterfaceHandel_t* cthis)
+{
+  if((cthis->RxTsRing == NULL)||(cthis->RxTsCount == cthis->CircDeep))
+    return;
+
+  size_t pos = cthis->RxTsHead+cthis->RxTsCount;
+
+  cthis->RxTsRing[(pos < cthis->CircDeep) ? pos : pos-cthis->CircDeep] = cthis->RxTs;
+  cthis->RxTsCount++;
+}
+
+/**
+ * @brief Take time stamp of frame popped from rx circbuff
+ * 
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ * @return uint64_t time stamp, 0 - time stamps off
+ */
+static inline uint64_t _this_ts_pop(InterfaceHandel_t* cthis)
+{
+  if((cthis->RxTsRing == NULL)||(cthis->RxTsCount == 0))
+    return 0;
+
+  uint64_t ts = cthis->RxTsRing[cthis->RxTsHead];
+
+  if(++cthis->RxTsHead == cthis->CircDeep)
+    cthis->RxTsHead = 0;
+  cthis->RxTsCount--;
+
+  return ts;
+}
+
+/**
+ * @brief Account queue residency of frame read by application
+ * 
+ * @param[in] cthis pointer to @ref InterfaceHandel_t 
+ * @param[in] ts    arrival time stamp of frame
+ */
+static void _this_rx_residency(InterfaceHandel_t* cthis,uint64_t ts)
+{
+  uint64_t now = cthis->TsClock.func(cthis->TsClock.parent);
+  uint64_t res = (now > ts) ? now-ts : 0;
+
+  cthis->RxResidency.Frames++;
+  cthis->RxResidency.Sum += res;
+  cthis->RxResidency.Last = res;
+  if(res > cthis->RxResidency.Max)
+    cthis->RxResidency.Max = res;
+  if((cthis->LateAfter != 0)&&(res > cthis->LateAfter))
+    cthis->RxResidency.Late++;
+}
+
+
+/**
+ * @brief Interface data parser
+ * 
+ * @param[in]   this pointer to @ref InterfaceHandel_t 
+ * @param[in]   src data  
+ * @param[in]   len data leng
+ * @return      size_t parsed data leng
+ */
+static size_t _this_rx_parser(InterfaceHandel_t* cthis,uint8_t* src,size_t len)
+{
+  size_t pack_leng = 0;
+  const sInterfaceAcceptFilter_t* accept = atomic_load_explicit(&cthis->cAccept,memory_order_acquire);
+  sCRCInterface_t* crc    = _this_rx_crc(cthis);
+  AlgoProto        unpack = _this_rx_unpack(cthis);
+
+  if(HwGetRxStatus(cthis->HwInter) != kHwRx_Ok)
+  {
+    cthis->HwRxErrors++;
+    return 0;
+  }
+
+  if((accept != NULL)&&accept->PreUnpack)
+  {
+    if(!_this_rx_accept(cthis,accept,src,len))
+      return 0;
+    accept = NULL;
+  }
+  
+  if(unpack != NULL)
+  {
+    if((pack_leng = unpack(cthis->Pack,src,len)) == 0)
+      return 0;
+    cthis->CurData = cthis->Pack;
+  }
+  else
+  {
+    pack_leng = len;
+    cthis->CurData = src;
+  }
+  
+  /* filter sees application data: before crc if nothing transforms it, at the end else*/
+  bool late_filter = (cthis->cCompress != NULL)||(cthis->StageCnt != 0);
+
+  if(!late_filter)
+  {
+    if((accept != NULL)&&!_this_rx_accept(cthis,accept,cthis->CurData,pack_leng))
+      return 0;
+    if(!_this_rx_filter(cthis,pack_leng))
+      return 0;    
+  }
+    
+  if(crc != NULL)
+  {
+    if(pack_leng<=CRC_GetSize(crc))
+      return 0;
+    if(!_this_CRCcheck(cthis,cthis->CurData,pack_leng))
+      return 0;
+    else 
+      pack_leng-=CRC_GetSize(crc);
+  }
+
+  if((cthis->StageCnt != 0)&&((pack_leng = _this_rx_stages(cthis,pack_leng)) == 0))
+    return 0;
+
+  if(cthis->cCompress != NULL)
+  {
+    if((pack_leng = InterfaceCompress_Unpack(cthis->cCompress,&cthis->CurData,cthis->CurData,pack_leng)) == 0)
+      return 0;
+  }
+
+  if(late_filter)
+  {
+    if((accept != NULL)&&!_this_rx_accept(cthis,accept,cthis->CurData,pack_leng))
+      return 0;
+    if(!_this_rx_filter(cthis,pack_leng))
+      return 0;
+  }
+  
+  return pack_leng;
+}
+
+/**
+ * @brief Check frame key with acceptance filter in constant time
+ * 
+ * @param[in]   cthis   pointer to @ref InterfaceHandel_t 
+ * @param[in]   accept  pointer to @ref sInterfaceAcceptFilter_t
+ * @param[in]   data    frame
+ * @param[in]   len     frame leng
+ * @return true   if frame accepted
+ * @return false  if frame rejected (counted)
+ */
+static bool _this_rx_accept(InterfaceHandel_t* cthis,const sInterfaceAcceptFilter_t* accept,const uint8_t* data,size_t len)
+{
+  uint32_t key = 0;
+  bool     hit = false;
+
+  if(Interface_GetKey(&accept->Key,data,len,&key))
+  {
+    if(key < accept->BitmapSize)
+      hit = (accept->Bitmap[key>>3]>>(key&7))&1u;
+    else
+    {
+      size_t cnt = (accept->MaskCnt < INTERFACE_ACCEPT_MAX_MASKS) ? accept->MaskCnt : INTERFACE_ACCEPT_MAX_MASKS;
+
+      for(size_t i = 0;i<cnt;i++)
+        hit |= ((key & accept->Masks[i].Mask) == accept->Masks[i].Id);
+    }
+  }
+
+  if(!hit)
+    cthis->AcceptRejected++;
+
+  return hit;
+}
+
+/**
+ * @brief Run rx pipeline from last stage to first one
+ * @details not in place stage ping-pongs between StageRx and Pack
+ * @param[in]   cthis pointer to @ref InterfaceHandel_t 
+ * @param[in]   len   current data leng
+ * @return      size_t output leng, 0 if frame dropped
+ */
+static size_t _this_rx_stages(InterfaceHandel_t* cthis,size_t len)
+{
+  for(size_t i = cthis->StageCnt;i-- > 0;)
+  {
+    const sInterfaceStage_t* stage = &cthis->Stages[i];
+
+    if(stage->Rx == NULL)
+      continue;
+
+    if(stage->InPlace)
+      len = stage->Rx(stage->parent,cthis->CurData,cthis->CurData,len,len);
+    else
+    {
+      uint8_t* dst = (cthis->CurData == cthis->StageRx) ? cthis->Pack : cthis->StageRx;
+
+      len = stage->Rx(stage->parent,dst,cthis->CurData,len,cthis->RxBuffLen);
+      cthis->CurData = dst;
+    }
+
+    if(len == 0)
+      return 0;
+  }
+
+  return len;
+}
+
+/**
+ * @brief Run tx pipeline from first stage to last one
+ * @details caller data is never modified, first stage writes to scratch buffer,
+ *          then in place stages stay there and others ping-pong between StageTx pair
+ * @param[in]     cthis pointer to @ref InterfaceHandel_t 
+ * @param[in,out] data  pointer to current data pointer
+ * @param[in]     len   current data leng
+ * @return        size_t output leng, 0 if frame dropped
+ */
+static size_t _this_tx_stages(InterfaceHandel_t* cthis,uint8_t** data,size_t len)
+{
+  uint8_t* cur = *data;
+  size_t   max = cthis->StageTxLen-INTERFACE_CRC_SPARE;
+
+  for(size_t i = 0;i<cthis->StageCnt;i++)
+  {
+    const sInterfaceStage_t* stage = &cthis->Stages[i];
+
+    if(stage->Tx == NULL)
+      continue;
+
+    bool     own = (cur == cthis->StageTx[0])||(cur == cthis->StageTx[1]);
+    uint8_t* dst = (stage->InPlace && own) ? cur : ((cur == cthis->StageTx[0]) ? cthis->StageTx[1] : cthis->StageTx[0]);
+
+    if((len = stage->Tx(stage->parent,dst,cur,len,max)) == 0)
+      return 0;
+    cur = dst;
+  }
+
+  *data = cur;
+  return len;
+}
+
+/**
+ * @brief Apply rx filter to current data
+ * 
+ * @param[in]   cthis pointer to @ref InterfaceHandel_t 
+ * @param[in]   len   current data leng
+ * @return true   if frame accepted (or no filter)
+ * @return false  if frame discarded
+ */
+static bool _this_rx_filter(const InterfaceHandel_t* cthis,size_t len)
+{
+  if(cthis->cFilter == NULL)
+    return true;
+
+  return cthis->cFilter->func(cthis->cFilter->parent,cthis->CurData,len);
+}
+
+
+
+
+/**
+ * @brief Check crc wrapper 
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t 
+ * @param data pointer to data
+ * @param len  sizeof of data
+ * @return true   if crc ok
+ * @return false  else
+ */
+bool  _this_CRCcheck(const InterfaceHandel_t* cthis,const uint8_t* pack,const uint32_t len)
+{
+  uint32_t crc_shift = len-CRC_GetSize(cthis->cCRC);
+     
+  uint16_t crc = CRC_GetCRC(cthis->cCRC,pack,crc_shift);
+  uint16_t rx_crc;
+
+  memcpy(&rx_crc,pack+crc_shift,sizeof(rx_crc)); /* crc may be unaligned*/
+  
+  if(crc != rx_crc) 
+    return false;
+  else 
+    return true;
+}
+
+
+
+/**
+ * @brief Send data via @ref InterfaceHandel_t
+ * 
+ * @param[in] cthis     pointer to @ref InterfaceHandel_t 
+ * @param[in] payload   pointer to data 
+ * @param[in] leng      data size to send
+ * @return true 
+ * @return false 
+ */
+bool Interface_SendData(InterfaceHandel_t* cthis,void *payload, size_t leng)
+{ 
+  uint8_t* cur_data = payload;
+  uint32_t key      = 0;
+
+  if(cthis->RawMode)
+    return Interface_Send_cu8(cthis,cur_data,leng);
+
+  if(cthis->cMpsc != NULL)
+    return _this_tx_mpsc(cthis,cur_data,leng,true);
+
+  /* conflation key is in payload, read it before stages and packing*/
+  bool keyed = (cthis->cTxq != NULL)&&Interface_GetKey(&cthis->TxKey,cur_data,leng,&key);
+
+  /* fixed order: compression sees plain payload, stages (encryption) see compressed one*/
+  if(cthis->cCompress != NULL)
+  {
+    if((leng = InterfaceCompress_Pack(cthis->cCompress,&cur_data,cur_data,leng)) == 0)
+      return false;
+  }
+
+  if((cthis->StageCnt != 0)&&((leng = _this_tx_stages(cthis,&cur_data,leng)) == 0))
+    return false;
+
+  if(_this_tx_crc(cthis) != NULL)
+  {
+    if(leng+CRC_GetSize(cthis->cCRC)>cthis->TxBuffLen)
+      return false;
+    _this_InsertCRC(cthis,cur_data,&leng);
+  }
+  
+  AlgoProto pack = _this_tx_pack(cthis);
+
+  if(pack != NULL)
+  {
+    leng = pack(cthis->TxBuff,cur_data,leng);
+    cur_data = cthis->TxBuff;
+  }
+
+  return _this_tx_send(cthis,cur_data,leng,keyed ? &key : NULL);
+}
+
+inline bool   Interface_Send_cu8(InterfaceHandel_t* cthis,const uint8_t* data,size_t leng)
+{
+  uint32_t key = 0;
+
+  if(leng == 0)
+    return false;
+
+  if(cthis->cMpsc != NULL)
+    return _this_tx_mpsc(cthis,data,leng,false);
+
+  bool keyed = (cthis->cTxq != NULL)&&Interface_GetKey(&cthis->TxKey,data,leng,&key);
+
+  return _this_tx_send(cthis,data,leng,keyed ? &key : NULL);
+}
+
+/**
+ * @brief Send frame to driver, or queue it if driver is busy
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @param data  wire frame
+ * @param leng  frame size
+ * @param key   conflation key, NULL - frame is never replaced
+ * @return true   if frame sent or queued
+ * @return false  queue full
+ */
+static bool _this_tx_send(InterfaceHandel_t* cthis,const uint8_t* data,size_t leng,const uint32_t* key)
+{
+  if(leng == 0)
+    return false;
+
+  cthis->Tx_len = leng;  
+
+  bool state = false;
+
+  if(_this_tx_paced(cthis,leng)&&_this_tx_hw(cthis,data,cthis->Tx_len)) 
+  {
+    _this_shaper_charge(cthis,leng);
+    return true;
+  }
+  else 
+  {
+    if(!cthis->CircBuffTx)
+      return false;
+
+    if(cthis->irqmode == kInterfaceRxTx_irq)
+    {  
+      HwEnterCriticalTx(cthis->HwInter);
+      
+      state = _this_txq_push(cthis,data,cthis->Tx_len,key);
+    
+      HwExitCriticalTx(cthis->HwInter);
+    }
+    else
+    {
+      if((state = _this_txq_push(cthis,data,cthis->Tx_len,key)))
+        _this_tx_notify(cthis);
+    }
+  }
+  return state;
+}
+
+
+bool Interface_Send_str(InterfaceHandel_t* cthis,const char* str,size_t leng) {return Interface_Send_cu8(cthis,(const uint8_t*)str,leng);}
+
+/**
+ * @brief Frame payload into own slot of multi-producer queue
+ * 
+ * @param cthis   pointer to @ref InterfaceHandel_t
+ * @param data    payload
+ * @param leng    payload size
+ * @param framing true - add crc and pack, false - raw
+ * @return true   if frame queued
+ * @return false  queue full, frame too long or not supported pipeline
+ */
+static bool _this_tx_mpsc(InterfaceHandel_t* cthis,const uint8_t* data,size_t leng,bool framing)
+{
+  uint8_t* frame = _this_tx_mpsc_reserve(cthis,leng,framing);
+
+  if(frame == NULL)
+    return false;
+
+  memcpy(frame,data,leng);
+
+  return _this_tx_mpsc_commit(cthis,frame,leng,framing);
+}
+
+/**
+ * @brief Reserve own slot of multi-producer queue for payload
+ * 
+ * @param cthis   pointer to @ref InterfaceHandel_t
+ * @param leng    max payload size
+ * @param framing true - crc and pack on commit, false - raw
+ * @return uint8_t* payload memory in slot, NULL - queue full, too long or not supported pipeline
+ */
+static uint8_t* _this_tx_mpsc_reserve(InterfaceHandel_t* cthis,size_t leng,bool framing)
+{
+  size_t crc_size = (framing && (_this_tx_crc(cthis) != NULL)) ? CRC_GetSize(cthis->cCRC) : 0;
+
+  if(framing && ((cthis->StageCnt != 0)||(cthis->cCompress != NULL)))
+    return NULL;
+  if(leng+crc_size > cthis->TxBuffLen)
+    return NULL;
+
+  size_t   ticket = 0;
+  uint8_t* slot   = InterfaceMpsc_Reserve(cthis->cMpsc,&ticket);
+
+  if(slot == NULL)
+    return NULL;
+
+  /* second half is pack source*/
+  return (framing && (_this_tx_pack(cthis) != NULL)) ? slot+cthis->TxBuffLen : slot;
+}
+
+/**
+ * @brief Frame payload in place and commit slot of multi-producer queue
+ * 
+ * @param cthis   pointer to @ref InterfaceHandel_t
+ * @param frame   payload memory from @ref _this_tx_mpsc_reserve
+ * @param leng    payload size, 0 - drop slot
+ * @param framing same as for reserve
+ * @return true   if frame queued
+ * @return false  slot dropped
+ */
+static bool _this_tx_mpsc_commit(InterfaceHandel_t* cthis,uint8_t* frame,size_t leng,bool framing)
+{
+  AlgoProto pack = framing ? _this_tx_pack(cthis) : NULL;
+  uint8_t*  slot = (pack != NULL) ? frame-cthis->TxBuffLen : frame;
+
+  if(leng != 0)
+  {
+    if(framing && (_this_tx_crc(cthis) != NULL))
+      _this_InsertCRC(cthis,frame,&leng);
+    if(pack != NULL)
+      leng = pack(slot,frame,leng);
+  }
+
+  InterfaceMpsc_CommitSlot(cthis->cMpsc,slot,leng);
+
+  if(cthis->irqmode == kInterfaceRxTx_irq)
+    _this_tx_mpsc_kick(cthis);
+  else
+    _this_tx_notify(cthis);
+
+  return leng != 0;
+}
+
+/**
+ * @brief Reserve tx memory for payload, write it in place then @ref Interface_TxCommit
+ * @details multi-producer mode: payload goes into own slot of the queue.
+ *          single producer: payload goes into TxBuff and is passed to driver from there
+ *          (or copied once to tx queue if driver got busy)
+ * @note  single producer without multi-producer mode needs double buffering
+ *        (@ref Interface_SetDoubleBuffer, tx irq pops queue into the hw buffer, that is TxBuff
+ *        when single buffered), free driver and no pipeline stages, compression and pack
+ *        algoritm (they can not work in place). Every reserve must be committed before
+ *        the next one from the same producer
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @param leng  max payload size
+ * @return uint8_t* payload memory, NULL - no room, too long or not supported pipeline
+ *         (send with @ref Interface_SendData instead)
+ */
+uint8_t*  Interface_TxReserve(InterfaceHandel_t* cthis,size_t leng)
+{
+  bool framing = !cthis->RawMode;
+
+  if(cthis->cMpsc != NULL)
+    return _this_tx_mpsc_reserve(cthis,leng,framing);
+
+  if(framing && ((cthis->StageCnt != 0)||(cthis->cCompress != NULL)||(_this_tx_pack(cthis) != NULL)))
+    return NULL;
+  if((cthis->TxHw == cthis->TxBuff)||!HwIsFree(cthis->HwInter))
+    return NULL;
+  if(leng+((framing && (_this_tx_crc(cthis) != NULL)) ? CRC_GetSize(cthis->cCRC) : 0) > cthis->TxBuffLen)
+    return NULL;
+
+  return cthis->TxBuff;
+}
+
+/**
+ * @brief Frame reserved payload in place (crc, pack) and send or queue it
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @param data  memory from @ref Interface_TxReserve (finds the slot in multi-producer mode)
+ * @param used  payload size, 0 - cancel
+ * @return true   if frame sent or queued
+ * @return false  canceled, queue full or bad pointer
+ */
+bool  Interface_TxCommit(InterfaceHandel_t* cthis,uint8_t* data,size_t used)
+{
+  bool framing = !cthis->RawMode;
+
+  if(cthis->cMpsc != NULL)
+    return _this_tx_mpsc_commit(cthis,data,used,framing);
+
+  if((data != cthis->TxBuff)||(used == 0))
+    return false;
+
+  uint32_t key   = 0;
+  bool     keyed = (cthis->cTxq != NULL)&&Interface_GetKey(&cthis->TxKey,data,used,&key);
+
+  if(framing && (_this_tx_crc(cthis) != NULL))
+    _this_InsertCRC(cthis,data,&used);
+
+  return _this_tx_send(cthis,data,used,keyed ? &key : NULL);
+}
+
+/**
+ * @brief Notify process runner about queued frame
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ */
+static inline void _this_tx_notify(InterfaceHandel_t* cthis)
+{
+  if(cthis->TxNotify.func != NULL)
+    cthis->TxNotify.func(cthis->TxNotify.parent);
+}
+
+/**
+ * @brief Start transmission from producer side if link is idle (irq mode)
+ * @details tx irq is masked while draining, other producers leave their kick
+ *          pending if one is already here. The holder drains again for them:
+ *          its drain may have stopped at a head slot that was not committed yet
+ * @param cthis pointer to @ref InterfaceHandel_t
+ */
+static void _this_tx_mpsc_kick(InterfaceHandel_t* cthis)
+{
+  atomic_store(&cthis->MpscKickPend,true);
+
+  while(!atomic_flag_test_and_set_explicit(&cthis->MpscKick,memory_order_acquire))
+  {
+    atomic_store(&cthis->MpscKickPend,false);
+
+    HwEnterCriticalTx(cthis->HwInter);
+    if(!cthis->MpscInFlight)
+      _this_tx_mpsc_drain(cthis);
+    HwExitCriticalTx(cthis->HwInter);
+
+    atomic_flag_clear_explicit(&cthis->MpscKick,memory_order_release);
+
+    /* commit of a producer that lost the guard since the pending clear*/
+    if(!atomic_load(&cthis->MpscKickPend))
+      return;
+  }
+}
+
+/**
+ * @brief Release slot finished by driver and send next committed one (consumer)
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ */
+static void _this_tx_mpsc_drain(InterfaceHandel_t* cthis)
+{
+  if(cthis->MpscInFlight)
+  {
+    InterfaceMpsc_Release(cthis->cMpsc);
+    cthis->MpscInFlight = false;
+  }
+
+  uint8_t* frame = NULL;
+  size_t   leng  = 0;
+
+  while((frame = InterfaceMpsc_Peek(cthis->cMpsc,&leng)) != NULL)
+  {
+    if(leng == 0)
+    {
+      InterfaceMpsc_Release(cthis->cMpsc); /* dropped by producer*/
+      continue;
+    }
+    if(!_this_shaper_ok(cthis,leng))
+      return; /* stays at head until tokens*/
+    if((cthis->MpscInFlight = HwSendData(cthis->HwInter,frame,leng)))
+      _this_shaper_charge(cthis,leng);
+    return;
+  }
+}
+
+/**
+ * @brief Pass frame to driver
+ * @details if double buffered and frame is in TxBuff, driver owns it until tx_cb
+ *          and the next frame is packed into the other buffer
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @param data  frame
+ * @param leng  frame size
+ * @return true   if driver takes the frame
+ * @return false  driver busy
+ */
+static inline bool _this_tx_hw(InterfaceHandel_t* cthis,const uint8_t* data,size_t leng)
+{
+  if((cthis->TxHw == cthis->TxBuff)||(data != cthis->TxBuff))
+    return HwSendData(cthis->HwInter,data,leng);
 
-  if((CAST_INTERFACE(cthis)->LastLeng = _this_rx_parser(cthis,src,len)) == 0)
-    return; /* No valid data*/
-    
-  if(CAST_INTERFACE(cthis)->parentCB.RxCb != NULL)
-    CAST_INTERFACE(cthis)->parentCB.RxCb(CAST_INTERFACE(cthis)->parentCB.parent,CAST_INTERFACE(cthis),CAST_INTERFACE(cthis)->CurData,CAST_INTERFACE(cthis)->LastLeng);
-  else
+  bool state;
+
+  if(cthis->irqmode == kInterfaceRxTx_irq)
+    HwEnterCriticalTx(cthis->HwInter); /* tx_cb must see the swapped buffers*/
+
+  if((state = HwSendData(cthis->HwInter,data,leng)))
   {
-    if(CAST_INTERFACE(cthis)->CircBuffRx)
-      CircBuff_push(CAST_INTERFACE(cthis)->CircBuffRx,CAST_INTERFACE(cthis)->CurData,CAST_INTERFACE(cthis)->LastLeng);
+    cthis->TxBuff = cthis->TxHw;
+    cthis->TxHw   = (uint8_t*)data;
   }
+
+  if(cthis->irqmode == kInterfaceRxTx_irq)
+    HwExitCriticalTx(cthis->HwInter);
+
+  return state;
 }
 
 
 /**
- * @brief Interface data parser
+ * @brief Interface tx Function for directly run in an interrupt 
  * 
- * @param[in]   this pointer to @ref InterfaceHandel_t 
- * @param[in]   src data  
- * @param[in]   len data leng
- * @return      size_t parsed data leng
+ * @details if irqmode = @arg kInterfaceRxTx_irq. whis should be  TX Notempty irq
+ * @param[in] this_ptr pointer to @ref InterfaceHandel_t  
  */
-static size_t _this_rx_parser(InterfaceHandel_t* cthis,uint8_t* src,size_t len)
+static void _this_tx_irq(void* this_ptr)
 {
-  size_t pack_leng = 0;
-  
-  if(cthis->AlgoritmUnpuck)
-  {
-    if((pack_leng = cthis->AlgoritmUnpuck(cthis->Pack,src,len)) == 0)
-      return 0;
-    cthis->CurData = cthis->Pack;
-  }
-  else
-  {
-    pack_leng = len;
-    cthis->CurData = src;
-  }
-  
-  if(cthis->cFilter != NULL)
-    if(!cthis->cFilter->func(cthis->cFilter->parent,cthis->CurData,pack_leng))
-      return 0;    
-    
-  if(cthis->cCRC != NULL)
+  InterfaceHandel_t* cthis = CAST_INTERFACE(this_ptr);
+
+  if(cthis->cMpsc != NULL)
   {
-    if(pack_leng<=CRC_GetSize(cthis->cCRC))
-      return 0;
-    if(!_this_CRCcheck(cthis,cthis->CurData,pack_leng))
-      return 0;
-    else 
-      pack_leng-=CRC_GetSize(cthis->cCRC);
+    _this_tx_mpsc_drain(cthis);
+    return;
   }
-
   
-  return pack_leng;
+  /* TxHw is released by driver here, TxBuff may be under packing*/
+  if(_this_txq_pop(cthis,cthis->TxHw,&cthis->Tx_len))
+    HwSendData(cthis->HwInter,cthis->TxHw,cthis->Tx_len);
 }
 
-
-
-
 /**
- * @brief Check crc wrapper 
- * 
- * @param cthis pointer to @ref InterfaceHandel_t 
- * @param data pointer to data
- * @param len  sizeof of data
- * @return true   if crc ok
- * @return false  else
+ * @brief Check frame may go to driver now
+ * @note  with shaper on, frames behind held or queued ones wait (order is kept)
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @param leng  frame size
+ * @return true   if no shaper, or nothing waits and bucket has tokens
+ * @return false  frame should be queued
  */
-bool  _this_CRCcheck(const InterfaceHandel_t* cthis,const uint8_t* pack,const uint32_t len)
+static inline bool _this_tx_paced(InterfaceHandel_t* cthis,size_t leng)
 {
-  uint32_t crc_shift = len-CRC_GetSize(cthis->cCRC);
-     
-  uint16_t crc = CRC_GetCRC(cthis->cCRC,pack,crc_shift);
-  
-  if(crc != (*((uint16_t*)(pack+crc_shift)))) 
+  if(cthis->TxHeldLen != 0)
     return false;
-  else 
+
+  if(cthis->Shaper.Rate == 0)
     return true;
-}
 
+  if((cthis->CircBuffTx != NULL)&&!_this_txq_empty(cthis))
+    return false;
 
+  return _this_shaper_ok(cthis,leng);
+}
 
 /**
- * @brief Send data via @ref InterfaceHandel_t
+ * @brief Refill bucket and check it holds frame
  * 
- * @param[in] cthis     pointer to @ref InterfaceHandel_t 
- * @param[in] payload   pointer to data 
- * @param[in] leng      data size to send
- * @return true 
- * @return false 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @param leng  frame size
+ * @return true   if frame may be sent (or no shaper)
+ * @return false  wait for tokens
  */
-bool Interface_SendData(InterfaceHandel_t* cthis,void *payload, size_t leng)
-{ 
+static bool _this_shaper_ok(InterfaceHandel_t* cthis,size_t leng)
+{
+  sInterfaceShaper_t* shaper = &cthis->Shaper;
 
-  if( cthis->cCRC != NULL && !cthis->RawMode)
-  {
-    if(leng+CRC_GetSize(cthis->cCRC)>cthis->TxBuffLen)
-      return false;
-    _this_InsertCRC(cthis,payload,&leng);
-  }
-  
-  uint8_t* cur_data = NULL;
-  
-  if(cthis->AlgoritmPack && !cthis->RawMode)
-  {
-    cthis->Tx_len = cthis->AlgoritmPack(cthis->TxBuff,(uint8_t*)payload,leng);
-    cur_data = cthis->TxBuff;
-  }
-  else  
-    cur_data = payload;
+  if(shaper->Rate == 0)
+    return true;
 
-  return Interface_Send_cu8(cthis,cur_data,leng);
-}
+  uint32_t now  = shaper->Clock.func(shaper->Clock.parent);
+  int64_t  full = (int64_t)shaper->Burst*1000;
 
-inline bool   Interface_Send_cu8(InterfaceHandel_t* cthis,const uint8_t* data,size_t leng)
-{
+  cthis->Tokens    += (int64_t)(uint32_t)(now-cthis->ShaperLast)*shaper->Rate;
+  cthis->ShaperLast = now;
+  if(cthis->Tokens > full)
+    cthis->Tokens = full;
 
-  if(leng == 0)
-    return false;
+  return cthis->Tokens >= (int64_t)((leng < shaper->Burst) ? leng : shaper->Burst)*1000;
+}
 
-  cthis->Tx_len = leng;  
+/**
+ * @brief Take frame size from bucket
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @param leng  frame size
+ */
+static inline void _this_shaper_charge(InterfaceHandel_t* cthis,size_t leng)
+{
+  if(cthis->Shaper.Rate != 0)
+    cthis->Tokens -= (int64_t)leng*1000;
+}
 
-  bool state = false;
+/**
+ * @brief Queue tx frame, conflation queue updates queued frame of the same key
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @param data  wire frame
+ * @param leng  frame size
+ * @param key   conflation key, NULL - append
+ * @return true   if frame queued or updated
+ * @return false  queue full
+ */
+static bool _this_txq_push(InterfaceHandel_t* cthis,const uint8_t* data,size_t leng,const uint32_t* key)
+{
+  if(cthis->cTxq == NULL)
+    return CircBuff_push(cthis->CircBuffTx,(uint8_t*)data,leng);
 
-  if(HwSendData(cthis->HwInter,data,cthis->Tx_len)) 
-    return true;
-  else 
+  switch(InterfaceKeyq_Push(cthis->cTxq,data,leng,key,false))
   {
-    if(!cthis->CircBuffTx)
-      return false;
-
-    if(cthis->irqmode == kInterfaceRxTx_irq)
-    {  
-      HwEnterCriticalTx(cthis->HwInter);
-      
-      state = CircBuff_push(cthis->CircBuffTx,cthis->TxBuff,cthis->Tx_len);
-    
-      HwExitCriticalTx(cthis->HwInter);
-    }
-    else
-      state = CircBuff_push(cthis->CircBuffTx,cthis->TxBuff,cthis->Tx_len);
+    case kInterfaceKeyq_Replace:  cthis->TxConflated++; return true;
+    case kInterfaceKeyq_Append:                         return true;
+    default:                                            return false;
   }
-  return state;
 }
 
+/**
+ * @brief Take oldest tx frame
+ * 
+ * @param[in]  cthis pointer to @ref InterfaceHandel_t
+ * @param[out] dst   output buffer
+ * @param[out] leng  frame size
+ * @return true   if frame taken
+ * @return false  queue empty
+ */
+static bool _this_txq_pop(InterfaceHandel_t* cthis,uint8_t* dst,size_t* leng)
+{
+  if(CircBuff_pop(cthis->CircBuffTx,dst,leng))
+    return true;
 
-bool Interface_Send_str(InterfaceHandel_t* cthis,const char* str,size_t leng) {return Interface_Send_cu8(cthis,(const uint8_t*)str,leng);}
-
+  return (cthis->cTxq != NULL)&&InterfaceKeyq_Pop(cthis->cTxq,dst,leng);
+}
 
 /**
- * @brief Interface tx Function for directly run in an interrupt 
+ * @brief Check tx queue is empty
  * 
- * @details if irqmode = @arg kInterfaceRxTx_irq. whis should be  TX Notempty irq
- * @param[in] this_ptr pointer to @ref InterfaceHandel_t  
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @return true   if nothing queued
+ * @return false  else
  */
-static void _this_tx_irq(void* this_ptr)
+static inline bool _this_txq_empty(InterfaceHandel_t* cthis)
 {
-  InterfaceHandel_t* cthis = CAST_INTERFACE(this_ptr);
-  
-  if(CircBuff_pop(cthis->CircBuffTx,cthis->TxBuff,&cthis->Tx_len))
-    HwSendData(cthis->HwInter,cthis->TxBuff,cthis->Tx_len);
+  return CircBuff_IsFree(cthis->CircBuffTx)&&((cthis->cTxq == NULL)||InterfaceKeyq_IsEmpty(cthis->cTxq));
 }
 
 
@@ -493,10 +2257,56 @@ static void _this_tx_irq(void* this_ptr)
  */
 static void _this_InsertCRC(const InterfaceHandel_t* cthis,uint8_t* src,size_t* len)
 {
-  *((uint16_t*)(src+*len)) = CRC_GetCRC(cthis->cCRC,src,*len);
+  uint16_t crc = CRC_GetCRC(cthis->cCRC,src,*len);
+
+  memcpy(src+*len,&crc,sizeof(crc)); /* crc may be unaligned*/
   *len += CRC_GetSize(cthis->cCRC);
 }
 
+/**
+ * @brief Get crc to check in software
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @return sCRCInterface_t* installed crc, NULL if none or driver checks it
+ */
+static inline sCRCInterface_t* _this_rx_crc(const InterfaceHandel_t* cthis)
+{
+  return (cthis->HwCaps & kHwCap_RxCrc) ? NULL : cthis->cCRC;
+}
+
+/**
+ * @brief Get crc to append in software
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @return sCRCInterface_t* installed crc, NULL if none or driver appends it
+ */
+static inline sCRCInterface_t* _this_tx_crc(const InterfaceHandel_t* cthis)
+{
+  return (cthis->HwCaps & kHwCap_TxCrc) ? NULL : cthis->cCRC;
+}
+
+/**
+ * @brief Get unpack algoritm to run in software
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @return AlgoProto installed unpack, NULL if none or driver delimits frames
+ */
+static inline AlgoProto _this_rx_unpack(const InterfaceHandel_t* cthis)
+{
+  return (cthis->HwCaps & kHwCap_Framed) ? NULL : cthis->AlgoritmUnpuck;
+}
+
+/**
+ * @brief Get pack algoritm to run in software
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t
+ * @return AlgoProto installed pack, NULL if none or driver delimits frames
+ */
+static inline AlgoProto _this_tx_pack(const InterfaceHandel_t* cthis)
+{
+  return (cthis->HwCaps & kHwCap_Framed) ? NULL : cthis->AlgoritmPack;
+}
+
 
 /**
  * @brief Read Data from Interface buffer
@@ -505,40 +2315,55 @@ static void _this_InsertCRC(const InterfaceHandel_t* cthis,uint8_t* src,size_t*
  * @param dst  pointer to output data
  * @return size_t size of output data
  */
-size_t Interface_readData(InterfaceHandel_t* cthis,void* dst)
+size_t Interface_readData(InterfaceHandel_t* cthis,void* dst) {return Interface_readDataTs(cthis,dst,NULL);}
+
+/**
+ * @brief Read Data from Interface buffer with arrival time stamp
+ * @details time stamps need @ref Interface_SetRxTimestamps, queue residency of
+ *          the frame is accounted in @ref Interface_GetRxResidency
+ * @param cthis this pointer to @ref InterfaceHandel_t  
+ * @param dst  pointer to output data
+ * @param ts   arrival time stamp of frame, 0 - time stamps off, NULL - not needed
+ * @return size_t size of output data
+ */
+size_t Interface_readDataTs(InterfaceHandel_t* cthis,void* dst,uint64_t* ts)
 {
+  size_t   leng  = 0;
+  uint64_t stamp = 0;
+
   if(cthis->CircBuffRx)
   {
-    if(CircBuff_IsFree(cthis->CircBuffRx))
+    if(_this_rxq_empty(cthis))
       return 0;
-    
-    size_t leng = 0;
 
     if(cthis->irqmode == kInterfaceRxTx_irq)
-    {
       HwEnterCriticalRx(cthis->HwInter);
 
-      CircBuff_pop(cthis->CircBuffRx,dst,&leng);
+    leng = _this_rxq_pop(cthis,dst,&stamp);
 
-      HwExitCriticalRx(cthis->HwInter);
-    }
-    else
-      CircBuff_pop(cthis->CircBuffRx,dst,&leng);
+    if((leng != 0)&&(cthis->cArq != NULL))
+      _this_rx_arq_drain(cthis); /* frames held by full queue*/
 
-    return leng;
+    if(cthis->irqmode == kInterfaceRxTx_irq)
+      HwExitCriticalRx(cthis->HwInter);
   }
   else 
   { 
     if(cthis->LastLeng)
     {
-      __auto_type ret = cthis->LastLeng;
+      leng = cthis->LastLeng;
       cthis->LastLeng = 0;
-      memcpy(dst,cthis->RxBuff,ret);      
-      return ret;
+      stamp = cthis->RxTs;
+      memcpy(dst,cthis->RxBuff,leng);
     }
-    else
-      return 0;
   }
+
+  if((leng != 0)&&(cthis->TsClock.func != NULL))
+    _this_rx_residency(cthis,stamp);
+  if(ts != NULL)
+    *ts = stamp;
+
+  return leng;
 }
 
 /**
@@ -577,7 +2402,7 @@ size_t  Interface_readDataPtr(InterfaceHandel_t* cthis,uint8_t** dst)
 bool  Interface_isRxNe(InterfaceHandel_t* cthis)
 {
   if(cthis->CircBuffRx)
-    return !CircBuff_IsFree(cthis->CircBuffRx);
+    return !_this_rxq_empty(cthis);
   else
     return cthis->LastLeng;
 }
@@ -613,13 +2438,118 @@ bool Interface_Disconnect(InterfaceHandel_t* cthis)
  * @param cthis pointer to @ref InterfaceHandel_t 
  */
 void Interface_process(InterfaceHandel_t* cthis)
+{
+  (void)Interface_poll(cthis);
+}
+
+/**
+ * @brief Interface main process with activity report
+ * @details same as @ref Interface_process, for adaptive runners
+ * @param cthis pointer to @ref InterfaceHandel_t 
+ * @return true   if frame was received or handed to driver
+ * @return false  idle
+ */
+bool Interface_poll(InterfaceHandel_t* cthis)
 {
   if(cthis->irqmode == kInterfaceRxTx_irq)
-    return; /* should not be use in irq mode*/
+    return false; /* should not be use in irq mode*/
 
-  _this_CmdRxUploadProc(cthis);
-  _this_CmdTxUploadProc(cthis);
-  
+  bool active = _this_CmdRxUploadProc(cthis);
+
+  if(cthis->cArq)
+    InterfaceArq_process(cthis->cArq);
+  if(cthis->cFrag)
+    InterfaceFrag_process(cthis->cFrag);
+
+  active |= _this_CmdTxUploadProc(cthis);
+
+  return active;
+}
+
+/**
+ * @brief Set callback on frame queued for @ref Interface_process
+ * @details called from sender context when frame waits in tx queue (process mode),
+ *          lets a sleeping runner wake up at once
+ * @param cthis   pointer to @ref InterfaceHandel_t 
+ * @param notify  pointer to @ref sInterfaceNotify_t, NULL to remove
+ */
+void Interface_SetTxNotify(InterfaceHandel_t* cthis,const sInterfaceNotify_t* notify)
+{
+  if(notify != NULL)
+    cthis->TxNotify = *notify;
+  else
+    memset(&cthis->TxNotify,0,sizeof(cthis->TxNotify));
+}
+
+/**
+ * @brief Set rx time stamps
+ * @details every frame gets the time of its arrival at the driver: @ref HwInterface_vtable_t
+ *          GetRxTs if the driver has it, else clock at rx irq entry / ReadRxBuff return.
+ *          Queued frames keep their stamp (parallel ring of rx circbuff, tag of keyed
+ *          queue), @ref Interface_readDataTs returns it and accounts queue residency.
+ *          In a rx callback the stamp of the current frame is @ref Interface_GetRxTs
+ * @note  driver stamps must be in the clock domain. Call before frames are queued,
+ *        in irq mode with rx disabled
+ * @param cthis     pointer to @ref InterfaceHandel_t 
+ * @param clock     pointer to @ref sInterfaceTsClock_t, NULL to switch off
+ * @param LateAfter residency counted as late (consumer falls behind), 0 - not counted
+ * @return true   if set
+ * @return false  no memory
+ */
+bool Interface_SetRxTimestamps(InterfaceHandel_t* cthis,const sInterfaceTsClock_t* clock,uint64_t LateAfter)
+{
+  if((clock == NULL)||(clock->func == NULL))
+  {
+    memset(&cthis->TsClock,0,sizeof(cthis->TsClock));
+    heap_free(cthis->RxTsRing);
+    cthis->RxTsRing = NULL;
+    return true;
+  }
+
+  if((cthis->CircDeep != 0)&&(cthis->RxTsRing == NULL))
+  {
+    if((cthis->RxTsRing = heap_malloc(cthis->CircDeep*sizeof(uint64_t))) == NULL)
+      return false;
+  }
+
+  cthis->RxTsHead  = cthis->RxTsCount = 0;
+  cthis->RxTs      = 0;
+  cthis->LateAfter = LateAfter;
+  cthis->TsClock   = *clock;
+  memset(&cthis->RxResidency,0,sizeof(cthis->RxResidency));
+
+  return true;
+}
+
+/**
+ * @brief Get arrival time stamp of frame in process (inside rx callback)
+ * 
+ * @param cthis pointer to @ref InterfaceHandel_t 
+ * @return uint64_t time stamp, 0 - time stamps off
+ */
+uint64_t Interface_GetRxTs(InterfaceHandel_t* cthis) {return cthis->RxTs;}
+
+/**
+ * @brief Get rx queue residency statistic
+ * 
+ * @param[in]  cthis pointer to @ref InterfaceHandel_t 
+ * @param[out] res   pointer to @ref sInterfaceRxResidency_t
+ */
+void Interface_GetRxResidency(InterfaceHandel_t* cthis,sInterfaceRxResidency_t* res) {*res = cthis->RxResidency;}
+
+/**
+ * @brief Set capture tap of raw rx chunks
+ * @details tap gets every chunk returned by driver (ReadRxBuff or rx irq) before
+ *          parsing, in the driver context
+ * @param cthis pointer to @ref InterfaceHandel_t 
+ * @param tap   pointer to @ref sInterfaceTap_t, NULL to remove
+ */
+void Interface_SetCapture(InterfaceHandel_t* cthis,const sInterfaceTap_t* tap)
+{
+  if(tap != NULL)
+    cthis->Capture = *tap;
+  else
+    memset(&cthis->Capture,0,sizeof(cthis->Capture));
 }
 
 /**
@@ -627,28 +2557,32 @@ void Interface_process(InterfaceHandel_t* cthis)
  * @note  Check Rx flag, and append CircBuff is not empty
  * @param cthis pointer to @ref InterfaceHandel_t 
  */
-static void _this_CmdRxUploadProc(InterfaceHandel_t* cthis)
+static bool _this_CmdRxUploadProc(InterfaceHandel_t* cthis)
 {
   if(HwReadRxBuff(cthis->HwInter,cthis->RxBuff,&cthis->Rx_len,cthis->RxBuffLen))
   {
     if(cthis->Rx_len > cthis->RxBuffLen)
       while(1);
+
+    _this_rx_stamp(cthis);
+    _this_rx_capture(cthis,cthis->RxBuff,cthis->Rx_len);
     
     if(!cthis->RawMode)
     {
-      if((cthis->LastLeng = _this_rx_parser(cthis,cthis->RxBuff,cthis->Rx_len)) == 0)
-        return; /* No valid data*/       
-      if(cthis->CircBuffRx)
-        CircBuff_push(cthis->CircBuffRx,cthis->Pack,cthis->LastLeng);
+      _this_rx_frame(cthis,cthis->RxBuff,cthis->Rx_len);
     }
     else
     {
       cthis->LastLeng = cthis->Rx_len;
-      CircBuff_push(cthis->CircBuffRx,cthis->RxBuff,cthis->LastLeng);
+      if(_this_rx_direct(cthis))
+        cthis->parentCB.RxCb(cthis->parentCB.parent,cthis,cthis->RxBuff,cthis->LastLeng);
+      else
+        _this_rxq_push(cthis,cthis->RxBuff,cthis->LastLeng);
     }
-    
-    
+    return true;
   }
+
+  return false;
 }
 
 /**
@@ -656,17 +2590,45 @@ static void _this_CmdRxUploadProc(InterfaceHandel_t* cthis)
  * @note  Check Rx flag, and append CircBuff is not empty
  * @param cthis pointer to @ref InterfaceHandel_t 
  */
-static void _this_CmdTxUploadProc(InterfaceHandel_t* cthis)
+static bool _this_CmdTxUploadProc(InterfaceHandel_t* cthis)
 {
+  if(cthis->cMpsc != NULL)
+  {
+    if(!HwIsFree(cthis->HwInter))
+      return false;
+    _this_tx_mpsc_drain(cthis);
+    return cthis->MpscInFlight;
+  }
+
   if(!cthis->CircBuffTx)
-    return;
+    return false;
   
-  if(CircBuff_IsFree(cthis->CircBuffTx)) 
-    return;
+  if((cthis->TxHeldLen == 0)&&_this_txq_empty(cthis)) 
+    return false;
   
   if(!HwIsFree(cthis->HwInter)) 
-    return;
+    return false;
   
-  if(CircBuff_pop(cthis->CircBuffTx,cthis->TxBuff,&cthis->Tx_len))
-      HwSendData(cthis->HwInter,cthis->TxBuff,cthis->Tx_len);
+  if(cthis->TxHold == NULL)
+  {
+    size_t leng;
+
+    if(!_this_txq_pop(cthis,cthis->TxHw,&leng))
+      return false;
+    return HwSendData(cthis->HwInter,cthis->TxHw,leng);
+  }
+
+  /* shaper: frame waits in its own buffer, TxBuff may be packed meanwhile*/
+  if((cthis->TxHeldLen == 0)&&!_this_txq_pop(cthis,cthis->TxHold,&cthis->TxHeldLen))
+    return false;
+
+  if(!_this_shaper_ok(cthis,cthis->TxHeldLen))
+    return false; /* held until tokens*/
+
+  if(!HwSendData(cthis->HwInter,cthis->TxHold,cthis->TxHeldLen))
+    return false; /* held until driver takes it*/
+
+  _this_shaper_charge(cthis,cthis->TxHeldLen);
+  cthis->TxHeldLen = 0;
+  return true;
 }
\ No newline at end of file
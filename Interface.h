@@ -3,8 +3,8 @@
   * @file    Interface.h
   * @author  Kukushkin A.V.
   * @brief   header file for Interface.c
-  * @version  V1.0.4
-  * @date     29. Apr. 2026
+  * @version  V1.20.0
+  * @date     19. Oct. 2026
   ******************************************************************************
   */ 
 
@@ -43,11 +43,43 @@ extern "C"{
  */
 #define make_interface(parent,IntBuffSize,CircDeep) Interface_ctor((HWInterface_t*)parent,IntBuffSize,CircDeep)
 #define INTERFACE_HEAD_SIZE sizeof(InterfaceCmdDataHead_t)
+
+#ifndef INTERFACE_ACCEPT_MAX_MASKS
+#define INTERFACE_ACCEPT_MAX_MASKS  8u  /*!< Max id/mask entries of acceptance filter*/
+#endif
+
+#ifndef INTERFACE_MAX_STAGES
+#define INTERFACE_MAX_STAGES  8u  /*!< Max number of pipeline stages per interface*/
+#endif
+
+#define INTERFACE_CRC_SPARE   4u  /*!< room for crc appended after payload*/
+
+/**
+ * @brief Fuse two build time known stage functions into one @ref StageProto
+ * @note  second function runs in place on output of the first one, both get the same parent.
+ *        Use it twice (tx order and reverse rx order) for a bidirectional stage
+ */
+#define INTERFACE_STAGE_FUSE(name,first,second)                                           \
+  static size_t name(void* parent,uint8_t* dst,const uint8_t* src,size_t size,size_t dst_max) \
+  {                                                                                       \
+    if((size = first(parent,dst,src,size,dst_max)) == 0)                                  \
+      return 0;                                                                           \
+    return second(parent,dst,dst,size,dst_max);                                           \
+  }
 /** @}*/
 
 
 
 typedef struct InterfaceHandel InterfaceHandel_t;       /*!< Interface Class typedef*/
+typedef struct InterfaceArq    InterfaceArq_t;          /*!< Interface reliability layer Class typedef*/
+typedef struct InterfaceFrag   InterfaceFrag_t;         /*!< Interface fragmentation Class typedef*/
+typedef struct InterfaceCompress InterfaceCompress_t;   /*!< Interface compression Class typedef*/
+typedef struct InterfaceDispatch InterfaceDispatch_t;   /*!< Interface rx dispatch table Class typedef*/
+typedef struct InterfaceMpsc   InterfaceMpsc_t;         /*!< Interface MPSC slot queue Class typedef*/
+typedef struct InterfaceScratch InterfaceScratch_t;     /*!< Interface shared scratch pool Class typedef*/
+typedef struct InterfacePool   InterfacePool_t;         /*!< Interface handle pool Class typedef*/
+typedef struct InterfaceKeyq   InterfaceKeyq_t;         /*!< Interface keyed queue Class typedef*/
+typedef struct InterfaceAead   InterfaceAead_t;         /*!< Interface authenticated encryption Class typedef*/
 
 /**
  * @brief Interface Rx Tx irq handel mode
@@ -100,6 +132,98 @@ typedef struct
  */
 typedef size_t (*AlgoProto)(uint8_t* dst,const uint8_t* src,size_t size);
 
+/**
+ * @brief Pipeline stage size_t func(void* parent,uint8_t* dst,const uint8_t* src,size_t size,size_t dst_max)
+ * @note  in place stage may be called with dst == src
+ * 
+ * @param   parent  pointer to stage owner
+ * @param   dst     pointer to destination data buffer 
+ * @param   src     pointer to source data buffer 
+ * @param   size    input data size
+ * @param   dst_max destination buffer size
+ * 
+ * @return  output data size, 0 to drop frame
+ */
+typedef size_t (*StageProto)(void* parent,uint8_t* dst,const uint8_t* src,size_t size,size_t dst_max);
+
+/**
+ * @brief Pipeline stage class
+ * @details order is fixed, tx: compression, stages from first added to last one,
+ *          crc, pack; rx: unpack, crc, stages from last added to first one,
+ *          decompression. So a cipher stage never hands ciphertext to the compressor
+ */
+typedef struct 
+{
+  void*       parent;   /*!< Pointer to stage owner*/
+  StageProto  Tx;       /*!< Send direction transform, NULL - pass through*/
+  StageProto  Rx;       /*!< Receive direction transform, NULL - pass through*/
+  size_t      Overhead; /*!< Max tx output growth in bytes*/
+  bool        InPlace;  /*!< Stage can run with dst == src*/
+}sInterfaceStage_t;
+
+/**
+ * @brief Frame key field (message id) description
+ * 
+ */
+typedef struct 
+{
+  uint16_t  Offset;     /*!< Key byte offset in frame*/
+  uint8_t   Width;      /*!< Key width in bytes (1..4)*/
+  bool      BigEndian;  /*!< Key byte order*/
+}sInterfaceKeyField_t;
+
+/**
+ * @brief Acceptance filter id/mask entry, key accepted if (key & Mask) == Id
+ * 
+ */
+typedef struct 
+{
+  uint32_t  Id;
+  uint32_t  Mask;
+}sInterfaceAcceptMask_t;
+
+/**
+ * @brief Acceptance filter (CAN-like hardware filter), checked in constant time
+ * @details key below BitmapSize is looked up in Bitmap, other keys are
+ *          compared with up to @ref INTERFACE_ACCEPT_MAX_MASKS id/mask entries
+ */
+typedef struct 
+{
+  sInterfaceKeyField_t          Key;        /*!< Key position*/
+  bool                          PreUnpack;  /*!< Key is readable in wire frame, check before unpack*/
+  const uint8_t*                Bitmap;     /*!< Accepted keys bitmap (bit n - key n), NULL - none*/
+  uint32_t                      BitmapSize; /*!< Bits in Bitmap*/
+  const sInterfaceAcceptMask_t* Masks;      /*!< Id/mask entries*/
+  size_t                        MaskCnt;    /*!< Number of id/mask entries*/
+}sInterfaceAcceptFilter_t;
+
+/**
+ * @brief Read key field from frame
+ * 
+ * @param field pointer to @ref sInterfaceKeyField_t
+ * @param data  pointer to frame
+ * @param len   frame leng
+ * @param key   pointer to output key
+ * @return true   if frame long enough
+ * @return false  else
+ */
+static inline bool Interface_GetKey(const sInterfaceKeyField_t* field,const uint8_t* data,size_t len,uint32_t* key)
+{
+  if((size_t)field->Offset+field->Width > len)
+    return false;
+
+  uint32_t val = 0;
+
+  for(uint8_t i = 0;i<field->Width;i++)
+  {
+    uint8_t b = field->BigEndian ? data[field->Offset+i] : data[field->Offset+field->Width-1-i];
+    val = (val<<8)|b;
+  }
+
+  *key = val;
+  return true;
+}
+
 /**
  * @brief Rx Filter algoritmc bool func(uint8_t* src,size_t leng)
  * 
@@ -119,6 +243,138 @@ typedef struct
   RxFilter  func;   /*!< Pointer to filter algoritm*/
 }sInterfaceRxFilter_t;
 
+/**
+ * @brief Monotonic clock uint32_t func(void* parent)
+ * 
+ * @param parent pointer to clock owner
+ * @return current tick, free running with wrap around
+ */
+typedef uint32_t (*InterfaceGetTick)(void* parent);
+
+/**
+ * @brief Clock class
+ * 
+ */
+typedef struct 
+{
+  void*             parent; /*!< Pointer to clock owner*/
+  InterfaceGetTick  func;   /*!< Pointer to tick function*/
+}sInterfaceClock_t;
+
+/**
+ * @brief Notify function void func(void* parent)
+ * 
+ * @param parent pointer to notify owner
+ */
+typedef void (*InterfaceNotify)(void* parent);
+
+/**
+ * @brief Notify class
+ * 
+ */
+typedef struct 
+{
+  void*             parent; /*!< Pointer to notify owner*/
+  InterfaceNotify   func;   /*!< Pointer to notify function*/
+}sInterfaceNotify_t;
+
+/**
+ * @brief Tap function void func(void* parent,const uint8_t* data,size_t len)
+ * 
+ * @param parent pointer to tap owner
+ * @param data   raw chunk as read from driver
+ * @param len    chunk leng
+ */
+typedef void (*InterfaceTap)(void* parent,const uint8_t* data,size_t len);
+
+/**
+ * @brief Tap class
+ * 
+ */
+typedef struct 
+{
+  void*             parent; /*!< Pointer to tap owner*/
+  InterfaceTap      func;   /*!< Pointer to tap function*/
+}sInterfaceTap_t;
+
+/**
+ * @brief Time stamp clock uint64_t func(void* parent)
+ * 
+ * @param parent pointer to clock owner
+ * @return current time, monotonic, any unit (ns, us, timer ticks)
+ */
+typedef uint64_t (*InterfaceGetTime)(void* parent);
+
+/**
+ * @brief Time stamp clock class
+ * 
+ */
+typedef struct 
+{
+  void*             parent; /*!< Pointer to clock owner*/
+  InterfaceGetTime  func;   /*!< Pointer to time function*/
+}sInterfaceTsClock_t;
+
+/**
+ * @brief Rx queue residency, time from arrival to read, clock units
+ * 
+ */
+typedef struct 
+{
+  uint32_t  Frames;   /*!< Frames read with time stamp*/
+  uint32_t  Late;     /*!< Frames queued longer than LateAfter*/
+  uint64_t  Sum;      /*!< Sum of residency, mean = Sum / Frames*/
+  uint64_t  Max;
+  uint64_t  Last;
+}sInterfaceRxResidency_t;
+
+/**
+ * @brief Rx queue overflow policy
+ * 
+ */
+typedef enum
+{
+  kInterfaceOverflow_DropNewest = 0,  /*!< Full queue drops the received frame (default)*/
+  kInterfaceOverflow_OverwriteOldest, /*!< Full queue drops the oldest queued frame*/
+  kInterfaceOverflow_LatestPerKey,    /*!< Frame replaces queued frame of the same key, else as OverwriteOldest*/
+}eInterfaceOverflow_t;
+
+/**
+ * @brief Rx queue drop counters
+ * 
+ */
+typedef struct 
+{
+  uint32_t  Dropped;      /*!< Received frames lost, queue full*/
+  uint32_t  Overwritten;  /*!< Oldest queued frames dropped for newer ones*/
+  uint32_t  Replaced;     /*!< Queued frames superseded by a frame of the same key*/
+}sInterfaceRxDrops_t;
+
+/**
+ * @brief Tx token bucket shaper config
+ * 
+ */
+typedef struct 
+{
+  sInterfaceClock_t Clock;  /*!< Monotonic clock*/
+  uint32_t          Rate;   /*!< Bytes per 1000 clock ticks, 0 - off*/
+  uint32_t          Burst;  /*!< Bucket size, bytes*/
+}sInterfaceShaper_t;
+
+/**
+ * @brief Interface instance memory, bytes
+ * @note  shared objects (scratch pool, ARQ, fragmentation, compression, dispatch)
+ *        are not counted
+ */
+typedef struct 
+{
+  size_t  Handle;   /*!< Interface class*/
+  size_t  Buffers;  /*!< Rx, Tx, own Pack and double buffer spares*/
+  size_t  Queues;   /*!< Rx/Tx circbuff payload, multi-producer slots, keyed rx queue*/
+  size_t  Stages;   /*!< Pipeline stage scratch*/
+  size_t  Total;
+}sInterfaceFootprint_t;
+
 /**
  * @defgroup Interface_public_func Interface public function
  * @{
@@ -129,6 +385,11 @@ typedef struct
    */ 
   InterfaceHandel_t*  Interface_ctor(HWInterface_t* HwInter,size_t IntBuffSize,size_t CircDeep);
   void                Interface_dtor(InterfaceHandel_t* hdev);
+
+  InterfacePool_t*    InterfacePool_ctor(size_t Count,size_t IntBuffSize,size_t CircDeep);
+  void                InterfacePool_dtor(InterfacePool_t* pool);
+  InterfaceHandel_t*  InterfacePool_Acquire(InterfacePool_t* pool,HWInterface_t* HwInter);
+  void                InterfacePool_Release(InterfacePool_t* pool,InterfaceHandel_t* cthis);
   /** @}*/
   
   /**
@@ -136,6 +397,9 @@ typedef struct
    * @{
    */
   void                Interface_process(InterfaceHandel_t* cthis);
+  bool                Interface_poll(InterfaceHandel_t* cthis);
+  void                Interface_SetTxNotify(InterfaceHandel_t* cthis,const sInterfaceNotify_t* notify);
+  void                Interface_SetCapture(InterfaceHandel_t* cthis,const sInterfaceTap_t* tap);
   /** @}*/
   
    /**
@@ -145,6 +409,15 @@ typedef struct
   void                Interface_InstallProtoAlgoritm(InterfaceHandel_t* cthis,AlgoProto pack, AlgoProto unpack);
   bool                Interface_InstallCRCAlgoritm(InterfaceHandel_t* cthis,sCRCInterface_t* crc);
   bool                Interface_InstallFilter(InterfaceHandel_t* cthis,sInterfaceRxFilter_t* filter);
+  const sInterfaceAcceptFilter_t* Interface_SetAcceptFilter(InterfaceHandel_t* cthis,const sInterfaceAcceptFilter_t* filter);
+  uint32_t            Interface_GetAcceptRejected(InterfaceHandel_t* cthis);
+  uint32_t            Interface_GetHwRxErrors(InterfaceHandel_t* cthis);
+  bool                Interface_InstallCompress(InterfaceHandel_t* cthis,InterfaceCompress_t* comp);
+  bool                Interface_AddStage(InterfaceHandel_t* cthis,const sInterfaceStage_t* stage);
+  void                Interface_ClearStages(InterfaceHandel_t* cthis);
+  bool                Interface_InstallArq(InterfaceHandel_t* cthis,InterfaceArq_t* arq);
+  bool                Interface_InstallFrag(InterfaceHandel_t* cthis,InterfaceFrag_t* frag);
+  bool                Interface_InstallDispatch(InterfaceHandel_t* cthis,InterfaceDispatch_t* dispatch);
 
   bool                Interface_SetCB(InterfaceHandel_t* cthis,sInterfaceIrqParentCB_t* parentCB);
    /** @}*/
@@ -158,13 +431,30 @@ typedef struct
 
   void                Interface_SetRawMode(InterfaceHandel_t* cthis,bool state);
   bool                Interface_isRawMode(InterfaceHandel_t* cthis);
+  void                Interface_SetCutThrough(InterfaceHandel_t* cthis,bool state);
+  bool                Interface_SetDoubleBuffer(InterfaceHandel_t* cthis,bool state);
+  bool                Interface_SetMultiProducer(InterfaceHandel_t* cthis,size_t deep);
+  bool                Interface_SetScratch(InterfaceHandel_t* cthis,InterfaceScratch_t* pool);
+  bool                Interface_SetRxOverflow(InterfaceHandel_t* cthis,eInterfaceOverflow_t policy,const sInterfaceKeyField_t* key);
+  void                Interface_GetRxDrops(InterfaceHandel_t* cthis,sInterfaceRxDrops_t* drops);
+  bool                Interface_SetTxConflation(InterfaceHandel_t* cthis,const sInterfaceKeyField_t* key);
+  uint32_t            Interface_GetTxConflated(InterfaceHandel_t* cthis);
+  bool                Interface_SetShaper(InterfaceHandel_t* cthis,const sInterfaceShaper_t* shaper);
+  bool                Interface_SetRxTimestamps(InterfaceHandel_t* cthis,const sInterfaceTsClock_t* clock,uint64_t LateAfter);
+  uint64_t            Interface_GetRxTs(InterfaceHandel_t* cthis);
+  void                Interface_GetRxResidency(InterfaceHandel_t* cthis,sInterfaceRxResidency_t* res);
+  void                Interface_GetFootprint(InterfaceHandel_t* cthis,sInterfaceFootprint_t* fp);
 
   size_t              Interface_readData(InterfaceHandel_t* cthis,void *dst);
+  size_t              Interface_readDataTs(InterfaceHandel_t* cthis,void *dst,uint64_t* ts);
   size_t              Interface_readDataPtr(InterfaceHandel_t* cthis,uint8_t** dst);
 
   bool                Interface_SendData(InterfaceHandel_t* cthis,void *payload,size_t leng);
   bool                Interface_Send_cu8(InterfaceHandel_t* cthis,const uint8_t* data,size_t leng);
   bool                Interface_Send_str(InterfaceHandel_t* cthis,const char* str,size_t leng); 
+
+  uint8_t*            Interface_TxReserve(InterfaceHandel_t* cthis,size_t leng);
+  bool                Interface_TxCommit(InterfaceHandel_t* cthis,uint8_t* data,size_t used);
   
 
   
@@ -193,6 +483,88 @@ inline bool Interface_Send(InterfaceHandel_t* p, const uint8_t* d, size_t s) { r
 inline bool Interface_Send(InterfaceHandel_t* p, uint8_t* d, size_t s)       { return Interface_Send_cu8(p, d, s); }
 inline bool Interface_Send(InterfaceHandel_t* p, const char* d, size_t s)    { return Interface_Send_str(p, d, s); }
 inline bool Interface_Send(InterfaceHandel_t* p, char* d, size_t s)          { return Interface_Send_str(p, d, s); }
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Send message T built aside, when tx memory can not be reserved
+ * 
+ * @param p   pointer to @ref InterfaceHandel_t
+ * @param msg message
+ * @return true   if frame sent or queued
+ * @return false  no room
+ */
+template<typename T>
+inline bool Interface_SendCopy(InterfaceHandel_t* p, const T& msg)
+{
+  uint8_t buf[sizeof(T)+INTERFACE_CRC_SPARE];
+
+  std::memcpy(buf, &msg, sizeof(T));
+
+  return Interface_SendData(p, buf, sizeof(T));
+}
+
+/**
+ * @brief Build message T in place in tx memory and send it
+ * @details Interface_Send<Msg>(iface,[](Msg& m){ m.a = 1; }), message is written once,
+ *          straight to @ref Interface_TxReserve memory (built aside if slot is not
+ *          aligned for T, or sent by Interface_SendData if memory can not be reserved)
+ * @param p     pointer to @ref InterfaceHandel_t
+ * @param build callable void(T&), gets value initialized T
+ * @return true   if frame sent or queued
+ * @return false  no room
+ */
+template<typename T,typename Build,
+         typename = decltype(std::declval<Build&>()(std::declval<T&>()))>
+inline bool Interface_Send(InterfaceHandel_t* p, Build&& build)
+{
+  static_assert(std::is_trivially_copyable<T>::value,"Interface_Send<T>: T must be trivially copyable");
+
+  uint8_t* slot = Interface_TxReserve(p, sizeof(T));
+
+  if(slot == nullptr)
+  {
+    T msg{};
+    build(msg);
+    return Interface_SendCopy(p, msg);
+  }
+
+  if(reinterpret_cast<uintptr_t>(slot)%alignof(T) == 0)
+    build(*::new(static_cast<void*>(slot)) T{});
+  else
+  {
+    T msg{};
+    build(msg);
+    std::memcpy(slot, &msg, sizeof(T));
+  }
+
+  return Interface_TxCommit(p, slot, sizeof(T));
+}
+
+/**
+ * @brief Send trivially copyable message, one copy to tx memory
+ * 
+ * @param p   pointer to @ref InterfaceHandel_t
+ * @param msg message
+ * @return true   if frame sent or queued
+ * @return false  no room
+ */
+template<typename T,
+         typename = typename std::enable_if<std::is_trivially_copyable<T>::value && !std::is_pointer<T>::value>::type>
+inline bool Interface_Send(InterfaceHandel_t* p, const T& msg)
+{
+  uint8_t* slot = Interface_TxReserve(p, sizeof(T));
+
+  if(slot == nullptr)
+    return Interface_SendCopy(p, msg);
+
+  std::memcpy(slot, &msg, sizeof(T));
+
+  return Interface_TxCommit(p, slot, sizeof(T));
+}
 #else
 
 #define Interface_Send(parent, src, size) _Generic((src), \
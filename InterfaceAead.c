@@ -0,0 +1,777 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceAead.c
+ * @author   Wyrm
+ * @brief    ChaCha20-Poly1305 authenticated encryption stage for @ref InterfaceHandel_t
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Fill sInterfaceAeadCfg_t with the shared key and the direction ids, the
+     peer uses the same key with TxId and RxId swapped
+  2. Create the class with InterfaceAead_ctor(&cfg), get its stage by
+     InterfaceAead_GetStage() and add it by Interface_AddStage() as the last
+     stage (it must see the final payload), IntBuffSize of the interface must
+     hold INTERFACE_AEAD_OVERHEAD more bytes than the largest payload
+  3. Interface_SendData() seals every frame, the rx parser opens it after crc
+     check, frames with bad tag or replayed ones are dropped and counted in
+     InterfaceAead_GetStats(), rx filter and parent callback see plain data
+  4. Before the tx sequence runs out (InterfaceAead_GetTxSeq()) or when keys
+     rotate call InterfaceAead_Rekey() on both ends
+  5. InterfaceAead_Encrypt()/InterfaceAead_Decrypt() are plain RFC 8439 AEAD
+  @note  portable C, no tables, so timing does not depend on key or data
+*/
+
+
+#include <string.h>
+
+#include "wheap.h"
+
+#include "InterfaceAead.h"
+
+
+/**
+ * @addtogroup Interface_Aead
+ * @{
+ */
+
+/* Private macro -------------------------------------------------------------*/
+#define AEAD_BLOCK        64u               /*!< ChaCha20 block*/
+#define AEAD_POLY_BLOCK   16u               /*!< Poly1305 block*/
+#define AEAD_SEQ_LAST     UINT64_MAX        /*!< Sequence is never sent*/
+#define AEAD_MASK26       0x3FFFFFFu
+
+#define AEAD_ROTL(v,n)    (((v)<<(n))|((v)>>(32u-(n))))
+#define AEAD_QR(a,b,c,d)                          \
+  do                                              \
+  {                                               \
+    a += b; d ^= a; d = AEAD_ROTL(d,16);          \
+    c += d; b ^= c; b = AEAD_ROTL(b,12);          \
+    a += b; d ^= a; d = AEAD_ROTL(d,8);           \
+    c += d; b ^= c; b = AEAD_ROTL(b,7);           \
+  }while(0)
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Poly1305 state, 26-bit limbs
+ *
+ */
+typedef struct
+{
+  uint32_t  r[5];
+  uint32_t  h[5];
+  uint32_t  pad[4];
+}sAeadPoly_t;
+
+/**
+ * @brief InterfaceAead Class
+ *
+ */
+struct InterfaceAead
+{
+  uint32_t  Key[INTERFACE_AEAD_KEY_SIZE/4];  /*!< Key words*/
+  uint32_t  TxId;
+  uint32_t  RxId;
+  uint64_t  TxSeq;      /*!< Next tx sequence, starts at 1*/
+  uint64_t  RxTop;      /*!< Highest accepted rx sequence*/
+  uint64_t  RxMask;     /*!< Bit n - RxTop-n accepted*/
+  uint8_t   Window;
+
+  sInterfaceAeadStats_t Stats;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Aead_Private_Functions Interface authenticated encryption private functions
+  * @{
+  */
+  static inline uint32_t  _this_load32(const uint8_t* src);
+  static inline void      _this_store32(uint8_t* dst,uint32_t val);
+  static inline uint64_t  _this_load64(const uint8_t* src);
+  static inline void      _this_store64(uint8_t* dst,uint64_t val);
+  static void             _this_key_words(uint32_t* words,const uint8_t* key);
+  static void             _this_chacha_init(uint32_t* state,const uint32_t* key,const uint8_t* nonce);
+  static void             _this_chacha_block(const uint32_t* state,uint8_t* out);
+  static void             _this_chacha_xor(uint32_t* state,uint8_t* dst,const uint8_t* src,size_t len);
+  static void             _this_poly_init(sAeadPoly_t* poly,uint32_t* state);
+  static void             _this_poly_blocks(sAeadPoly_t* poly,const uint8_t* src,size_t blocks);
+  static void             _this_poly_pad(sAeadPoly_t* poly,const uint8_t* src,size_t len);
+  static void             _this_poly_finish(sAeadPoly_t* poly,size_t aad_len,size_t len,uint8_t* tag);
+  static void             _this_mac(uint32_t* state,const uint8_t* aad,size_t aad_len,const uint8_t* data,size_t len,uint8_t* tag);
+  static bool             _this_equal(const uint8_t* a,const uint8_t* b,size_t len);
+  static void             _this_wipe(void* data,size_t len);
+  static void             _this_nonce(uint8_t* nonce,uint32_t id,uint64_t seq);
+  static bool             _this_replay_check(const InterfaceAead_t* cthis,uint64_t seq);
+  static void             _this_replay_update(InterfaceAead_t* cthis,uint64_t seq);
+/** @}*/
+
+
+/**
+ * @brief InterfaceAead Class constructor
+ *
+ * @param cfg pointer to @ref sInterfaceAeadCfg_t, copied
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceAead_t* InterfaceAead_ctor(const sInterfaceAeadCfg_t* cfg)
+{
+  if((cfg == NULL)||(cfg->TxId == cfg->RxId)||(cfg->Window > INTERFACE_AEAD_WINDOW))
+    return NULL;
+
+  InterfaceAead_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceAead_t)) == NULL)
+    return NULL;
+  memset(cthis,0,sizeof(InterfaceAead_t));
+
+  cthis->TxId   = cfg->TxId;
+  cthis->RxId   = cfg->RxId;
+  cthis->Window = (cfg->Window == 0) ? INTERFACE_AEAD_WINDOW : cfg->Window;
+  InterfaceAead_Rekey(cthis,cfg->Key);
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceAead class destructor, key is wiped
+ *
+ * @param cthis pointer to @ref InterfaceAead_t
+ */
+void InterfaceAead_dtor(InterfaceAead_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  _this_wipe(cthis,sizeof(InterfaceAead_t));
+  heap_free(cthis);
+}
+
+/**
+ * @brief Set new key, tx sequence and replay window restart
+ * @note  both ends must switch keys together, frames in flight are dropped
+ * @param cthis pointer to @ref InterfaceAead_t
+ * @param key   @ref INTERFACE_AEAD_KEY_SIZE bytes
+ */
+void InterfaceAead_Rekey(InterfaceAead_t* cthis,const uint8_t* key)
+{
+  _this_key_words(cthis->Key,key);
+
+  /* sequence 0 is never sent, so it marks the empty window*/
+  cthis->TxSeq  = 1;
+  cthis->RxTop  = 0;
+  cthis->RxMask = 1;
+}
+
+/**
+ * @brief Get pipeline stage of the class
+ *
+ * @param cthis pointer to @ref InterfaceAead_t
+ * @param stage pointer to output @ref sInterfaceStage_t for @ref Interface_AddStage
+ */
+void InterfaceAead_GetStage(InterfaceAead_t* cthis,sInterfaceStage_t* stage)
+{
+  stage->parent   = cthis;
+  stage->Tx       = InterfaceAead_Seal;
+  stage->Rx       = InterfaceAead_Open;
+  stage->Overhead = INTERFACE_AEAD_OVERHEAD;
+  stage->InPlace  = true;
+}
+
+/**
+ * @brief Get next tx sequence
+ *
+ * @param cthis pointer to @ref InterfaceAead_t
+ * @return uint64_t sequence of the next sealed frame
+ */
+uint64_t InterfaceAead_GetTxSeq(InterfaceAead_t* cthis)
+{
+  return cthis->TxSeq;
+}
+
+/**
+ * @brief Seal frame, stage Tx function
+ * @note  may run in place (dst == src)
+ * @param parent  pointer to @ref InterfaceAead_t
+ * @param dst     output: sequence, ciphertext, tag
+ * @param src     plain frame
+ * @param size    plain frame size
+ * @param dst_max output buffer size
+ * @return size_t size + @ref INTERFACE_AEAD_OVERHEAD, 0 if no room or sequence exhausted
+ */
+size_t InterfaceAead_Seal(void* parent,uint8_t* dst,const uint8_t* src,size_t size,size_t dst_max)
+{
+  InterfaceAead_t* cthis = (InterfaceAead_t*)parent;
+
+  if((size+INTERFACE_AEAD_OVERHEAD > dst_max)||(cthis->TxSeq == AEAD_SEQ_LAST))
+  {
+    cthis->Stats.TxRefused++;
+    return 0;
+  }
+
+  uint64_t seq = cthis->TxSeq++;
+  uint8_t  nonce[INTERFACE_AEAD_NONCE_SIZE];
+  uint32_t state[16];
+  uint8_t* ct  = dst+INTERFACE_AEAD_SEQ_SIZE;
+
+  memmove(ct,src,size);
+  _this_store64(dst,seq);
+
+  _this_nonce(nonce,cthis->TxId,seq);
+  _this_chacha_init(state,cthis->Key,nonce);
+  _this_chacha_xor(state,ct,ct,size);
+  _this_mac(state,NULL,0,ct,size,ct+size);
+
+  cthis->Stats.TxFrames++;
+  return size+INTERFACE_AEAD_OVERHEAD;
+}
+
+/**
+ * @brief Open frame, stage Rx function
+ * @details replay window is checked before and updated only after the tag
+ *          is verified, so forged frames can not move it
+ * @note  may run in place (dst == src)
+ * @param parent  pointer to @ref InterfaceAead_t
+ * @param dst     output plain frame
+ * @param src     sealed frame
+ * @param size    sealed frame size
+ * @param dst_max output buffer size
+ * @return size_t plain size, 0 if frame dropped
+ */
+size_t InterfaceAead_Open(void* parent,uint8_t* dst,const uint8_t* src,size_t size,size_t dst_max)
+{
+  InterfaceAead_t* cthis = (InterfaceAead_t*)parent;
+
+  if((size <= INTERFACE_AEAD_OVERHEAD)||(size-INTERFACE_AEAD_OVERHEAD > dst_max))
+  {
+    cthis->Stats.RxShort++;
+    return 0;
+  }
+
+  size_t         len = size-INTERFACE_AEAD_OVERHEAD;
+  uint64_t       seq = _this_load64(src);
+  const uint8_t* ct  = src+INTERFACE_AEAD_SEQ_SIZE;
+
+  if(!_this_replay_check(cthis,seq))
+  {
+    cthis->Stats.RxReplay++;
+    return 0;
+  }
+
+  uint8_t  nonce[INTERFACE_AEAD_NONCE_SIZE];
+  uint8_t  tag[INTERFACE_AEAD_TAG_SIZE];
+  uint32_t state[16];
+
+  _this_nonce(nonce,cthis->RxId,seq);
+  _this_chacha_init(state,cthis->Key,nonce);
+  _this_mac(state,NULL,0,ct,len,tag);
+
+  if(!_this_equal(tag,ct+len,INTERFACE_AEAD_TAG_SIZE))
+  {
+    cthis->Stats.RxAuthFail++;
+    return 0;
+  }
+
+  /* dst <= ct, forward xor never overwrites unread input*/
+  _this_chacha_xor(state,dst,ct,len);
+  _this_replay_update(cthis,seq);
+
+  cthis->Stats.RxFrames++;
+  return len;
+}
+
+/**
+ * @brief ChaCha20-Poly1305 encryption (RFC 8439)
+ *
+ * @param key     @ref INTERFACE_AEAD_KEY_SIZE bytes
+ * @param nonce   @ref INTERFACE_AEAD_NONCE_SIZE bytes
+ * @param aad     additional data, may be NULL if aad_len 0
+ * @param aad_len additional data size
+ * @param dst     ciphertext, may be src
+ * @param src     plaintext
+ * @param len     plaintext size
+ * @param tag     output @ref INTERFACE_AEAD_TAG_SIZE bytes
+ */
+void InterfaceAead_Encrypt(const uint8_t* key,const uint8_t* nonce,const uint8_t* aad,size_t aad_len,
+                           uint8_t* dst,const uint8_t* src,size_t len,uint8_t* tag)
+{
+  uint32_t words[INTERFACE_AEAD_KEY_SIZE/4];
+  uint32_t state[16];
+
+  _this_key_words(words,key);
+  _this_chacha_init(state,words,nonce);
+  _this_chacha_xor(state,dst,src,len);
+  _this_mac(state,aad,aad_len,dst,len,tag);
+  _this_wipe(words,sizeof(words));
+  _this_wipe(state,sizeof(state));
+}
+
+/**
+ * @brief ChaCha20-Poly1305 decryption (RFC 8439)
+ *
+ * @param key     @ref INTERFACE_AEAD_KEY_SIZE bytes
+ * @param nonce   @ref INTERFACE_AEAD_NONCE_SIZE bytes
+ * @param aad     additional data, may be NULL if aad_len 0
+ * @param aad_len additional data size
+ * @param dst     plaintext, may be src, untouched if tag is bad
+ * @param src     ciphertext
+ * @param len     ciphertext size
+ * @param tag     @ref INTERFACE_AEAD_TAG_SIZE bytes
+ * @return true   if tag is valid
+ * @return false  else
+ */
+bool InterfaceAead_Decrypt(const uint8_t* key,const uint8_t* nonce,const uint8_t* aad,size_t aad_len,
+                           uint8_t* dst,const uint8_t* src,size_t len,const uint8_t* tag)
+{
+  uint32_t words[INTERFACE_AEAD_KEY_SIZE/4];
+  uint32_t state[16];
+  uint8_t  calc[INTERFACE_AEAD_TAG_SIZE];
+  bool     ok;
+
+  _this_key_words(words,key);
+  _this_chacha_init(state,words,nonce);
+  _this_mac(state,aad,aad_len,src,len,calc);
+
+  if((ok = _this_equal(calc,tag,INTERFACE_AEAD_TAG_SIZE)))
+    _this_chacha_xor(state,dst,src,len);
+
+  _this_wipe(words,sizeof(words));
+  _this_wipe(state,sizeof(state));
+  return ok;
+}
+
+/**
+ * @brief Get AEAD statistic
+ *
+ * @param cthis pointer to @ref InterfaceAead_t
+ * @param stats pointer to output @ref sInterfaceAeadStats_t
+ */
+void InterfaceAead_GetStats(InterfaceAead_t* cthis,sInterfaceAeadStats_t* stats)
+{
+  *stats = cthis->Stats;
+}
+
+/**
+ * @brief Little endian 32-bit read
+ *
+ * @param src pointer to data
+ * @return uint32_t value
+ */
+static inline uint32_t _this_load32(const uint8_t* src)
+{
+  return (uint32_t)src[0]|((uint32_t)src[1]<<8)|((uint32_t)src[2]<<16)|((uint32_t)src[3]<<24);
+}
+
+/**
+ * @brief Little endian 32-bit write
+ *
+ * @param dst pointer to data
+ * @param val value
+ */
+static inline void _this_store32(uint8_t* dst,uint32_t val)
+{
+  dst[0] = (uint8_t)val;
+  dst[1] = (uint8_t)(val>>8);
+  dst[2] = (uint8_t)(val>>16);
+  dst[3] = (uint8_t)(val>>24);
+}
+
+/**
+ * @brief Little endian 64-bit read
+ *
+ * @param src pointer to data
+ * @return uint64_t value
+ */
+static inline uint64_t _this_load64(const uint8_t* src)
+{
+  return (uint64_t)_this_load32(src)|((uint64_t)_this_load32(src+4)<<32);
+}
+
+/**
+ * @brief Little endian 64-bit write
+ *
+ * @param dst pointer to data
+ * @param val value
+ */
+static inline void _this_store64(uint8_t* dst,uint64_t val)
+{
+  _this_store32(dst,(uint32_t)val);
+  _this_store32(dst+4,(uint32_t)(val>>32));
+}
+
+/**
+ * @brief Key bytes to words
+ *
+ * @param words output 8 words
+ * @param key   @ref INTERFACE_AEAD_KEY_SIZE bytes
+ */
+static void _this_key_words(uint32_t* words,const uint8_t* key)
+{
+  for(size_t i = 0;i<INTERFACE_AEAD_KEY_SIZE/4;i++)
+    words[i] = _this_load32(key+4*i);
+}
+
+/**
+ * @brief ChaCha20 state, block counter 0
+ *
+ * @param state output 16 words
+ * @param key   key words
+ * @param nonce @ref INTERFACE_AEAD_NONCE_SIZE bytes
+ */
+static void _this_chacha_init(uint32_t* state,const uint32_t* key,const uint8_t* nonce)
+{
+  state[0] = 0x61707865u;
+  state[1] = 0x3320646Eu;
+  state[2] = 0x79622D32u;
+  state[3] = 0x6B206574u;
+  memcpy(&state[4],key,INTERFACE_AEAD_KEY_SIZE);
+  state[12] = 0;
+  state[13] = _this_load32(nonce);
+  state[14] = _this_load32(nonce+4);
+  state[15] = _this_load32(nonce+8);
+}
+
+/**
+ * @brief ChaCha20 block function
+ *
+ * @param state input state
+ * @param out   output @ref AEAD_BLOCK bytes of key stream
+ */
+static void _this_chacha_block(const uint32_t* state,uint8_t* out)
+{
+  uint32_t x0 = state[0], x1 = state[1], x2 = state[2], x3 = state[3];
+  uint32_t x4 = state[4], x5 = state[5], x6 = state[6], x7 = state[7];
+  uint32_t x8 = state[8], x9 = state[9], x10 = state[10],x11 = state[11];
+  uint32_t x12 = state[12],x13 = state[13],x14 = state[14],x15 = state[15];
+
+  for(int i = 0;i<10;i++)
+  {
+    AEAD_QR(x0,x4,x8,x12);
+    AEAD_QR(x1,x5,x9,x13);
+    AEAD_QR(x2,x6,x10,x14);
+    AEAD_QR(x3,x7,x11,x15);
+    AEAD_QR(x0,x5,x10,x15);
+    AEAD_QR(x1,x6,x11,x12);
+    AEAD_QR(x2,x7,x8,x13);
+    AEAD_QR(x3,x4,x9,x14);
+  }
+
+  _this_store32(out+0, x0+state[0]);
+  _this_store32(out+4, x1+state[1]);
+  _this_store32(out+8, x2+state[2]);
+  _this_store32(out+12,x3+state[3]);
+  _this_store32(out+16,x4+state[4]);
+  _this_store32(out+20,x5+state[5]);
+  _this_store32(out+24,x6+state[6]);
+  _this_store32(out+28,x7+state[7]);
+  _this_store32(out+32,x8+state[8]);
+  _this_store32(out+36,x9+state[9]);
+  _this_store32(out+40,x10+state[10]);
+  _this_store32(out+44,x11+state[11]);
+  _this_store32(out+48,x12+state[12]);
+  _this_store32(out+52,x13+state[13]);
+  _this_store32(out+56,x14+state[14]);
+  _this_store32(out+60,x15+state[15]);
+}
+
+/**
+ * @brief XOR data with key stream from block counter 1
+ * @note  dst may be src or below it
+ * @param state ChaCha20 state, counter is advanced
+ * @param dst   output
+ * @param src   input
+ * @param len   size
+ */
+static void _this_chacha_xor(uint32_t* state,uint8_t* dst,const uint8_t* src,size_t len)
+{
+  uint8_t ks[AEAD_BLOCK];
+
+  state[12] = 1;
+
+  while(len != 0)
+  {
+    size_t n = (len < AEAD_BLOCK) ? len : AEAD_BLOCK;
+
+    _this_chacha_block(state,ks);
+    state[12]++;
+
+    size_t i = 0;
+    for(;i+8<=n;i += 8)
+    {
+      uint64_t a,b;
+      memcpy(&a,src+i,8);
+      memcpy(&b,ks+i,8);
+      a ^= b;
+      memcpy(dst+i,&a,8);
+    }
+    for(;i<n;i++)
+      dst[i] = src[i]^ks[i];
+
+    dst += n;
+    src += n;
+    len -= n;
+  }
+
+  _this_wipe(ks,sizeof(ks));
+}
+
+/**
+ * @brief Poly1305 key from ChaCha20 block 0
+ *
+ * @param poly  output state
+ * @param state ChaCha20 state with counter 0
+ */
+static void _this_poly_init(sAeadPoly_t* poly,uint32_t* state)
+{
+  uint8_t key[AEAD_BLOCK];
+
+  state[12] = 0;
+  _this_chacha_block(state,key);
+
+  /* clamp r*/
+  poly->r[0] = (_this_load32(key+0))&0x3FFFFFFu;
+  poly->r[1] = (_this_load32(key+3)>>2)&0x3FFFF03u;
+  poly->r[2] = (_this_load32(key+6)>>4)&0x3FFC0FFu;
+  poly->r[3] = (_this_load32(key+9)>>6)&0x3F03FFFu;
+  poly->r[4] = (_this_load32(key+12)>>8)&0x00FFFFFu;
+
+  for(size_t i = 0;i<4;i++)
+    poly->pad[i] = _this_load32(key+16+4*i);
+
+  memset(poly->h,0,sizeof(poly->h));
+  _this_wipe(key,sizeof(key));
+}
+
+/**
+ * @brief Poly1305 full blocks, h = (h+m)*r mod 2^130-5
+ *
+ * @param poly   state
+ * @param src    data
+ * @param blocks number of @ref AEAD_POLY_BLOCK blocks
+ */
+static void _this_poly_blocks(sAeadPoly_t* poly,const uint8_t* src,size_t blocks)
+{
+  const uint32_t r0 = poly->r[0],r1 = poly->r[1],r2 = poly->r[2],r3 = poly->r[3],r4 = poly->r[4];
+  const uint32_t s1 = r1*5,s2 = r2*5,s3 = r3*5,s4 = r4*5;
+  uint32_t       h0 = poly->h[0],h1 = poly->h[1],h2 = poly->h[2],h3 = poly->h[3],h4 = poly->h[4];
+
+  while(blocks--)
+  {
+    h0 += (_this_load32(src+0))&AEAD_MASK26;
+    h1 += (_this_load32(src+3)>>2)&AEAD_MASK26;
+    h2 += (_this_load32(src+6)>>4)&AEAD_MASK26;
+    h3 += (_this_load32(src+9)>>6)&AEAD_MASK26;
+    h4 += (_this_load32(src+12)>>8)|(1u<<24);
+
+    uint64_t d0 = (uint64_t)h0*r0+(uint64_t)h1*s4+(uint64_t)h2*s3+(uint64_t)h3*s2+(uint64_t)h4*s1;
+    uint64_t d1 = (uint64_t)h0*r1+(uint64_t)h1*r0+(uint64_t)h2*s4+(uint64_t)h3*s3+(uint64_t)h4*s2;
+    uint64_t d2 = (uint64_t)h0*r2+(uint64_t)h1*r1+(uint64_t)h2*r0+(uint64_t)h3*s4+(uint64_t)h4*s3;
+    uint64_t d3 = (uint64_t)h0*r3+(uint64_t)h1*r2+(uint64_t)h2*r1+(uint64_t)h3*r0+(uint64_t)h4*s4;
+    uint64_t d4 = (uint64_t)h0*r4+(uint64_t)h1*r3+(uint64_t)h2*r2+(uint64_t)h3*r1+(uint64_t)h4*r0;
+    uint32_t c;
+
+    c = (uint32_t)(d0>>26); h0 = (uint32_t)d0&AEAD_MASK26;
+    d1 += c; c = (uint32_t)(d1>>26); h1 = (uint32_t)d1&AEAD_MASK26;
+    d2 += c; c = (uint32_t)(d2>>26); h2 = (uint32_t)d2&AEAD_MASK26;
+    d3 += c; c = (uint32_t)(d3>>26); h3 = (uint32_t)d3&AEAD_MASK26;
+    d4 += c; c = (uint32_t)(d4>>26); h4 = (uint32_t)d4&AEAD_MASK26;
+    h0 += c*5; c = h0>>26; h0 &= AEAD_MASK26;
+    h1 += c;
+
+    src += AEAD_POLY_BLOCK;
+  }
+
+  poly->h[0] = h0;
+  poly->h[1] = h1;
+  poly->h[2] = h2;
+  poly->h[3] = h3;
+  poly->h[4] = h4;
+}
+
+/**
+ * @brief Poly1305 data zero padded to the block size
+ *
+ * @param poly state
+ * @param src  data
+ * @param len  data size
+ */
+static void _this_poly_pad(sAeadPoly_t* poly,const uint8_t* src,size_t len)
+{
+  size_t full = len/AEAD_POLY_BLOCK;
+
+  _this_poly_blocks(poly,src,full);
+
+  if((len %= AEAD_POLY_BLOCK) != 0)
+  {
+    uint8_t last[AEAD_POLY_BLOCK] = {0};
+
+    memcpy(last,src+full*AEAD_POLY_BLOCK,len);
+    _this_poly_blocks(poly,last,1);
+  }
+}
+
+/**
+ * @brief Poly1305 lengths block and tag
+ *
+ * @param poly    state
+ * @param aad_len additional data size
+ * @param len     ciphertext size
+ * @param tag     output @ref INTERFACE_AEAD_TAG_SIZE bytes
+ */
+static void _this_poly_finish(sAeadPoly_t* poly,size_t aad_len,size_t len,uint8_t* tag)
+{
+  uint8_t lens[AEAD_POLY_BLOCK];
+
+  _this_store64(lens,(uint64_t)aad_len);
+  _this_store64(lens+8,(uint64_t)len);
+  _this_poly_blocks(poly,lens,1);
+
+  uint32_t h0 = poly->h[0],h1 = poly->h[1],h2 = poly->h[2],h3 = poly->h[3],h4 = poly->h[4];
+  uint32_t c,g0,g1,g2,g3,g4,mask;
+
+  /* full carry*/
+               c = h1>>26; h1 &= AEAD_MASK26;
+  h2 += c;     c = h2>>26; h2 &= AEAD_MASK26;
+  h3 += c;     c = h3>>26; h3 &= AEAD_MASK26;
+  h4 += c;     c = h4>>26; h4 &= AEAD_MASK26;
+  h0 += c*5;   c = h0>>26; h0 &= AEAD_MASK26;
+  h1 += c;
+
+  /* g = h+5-2^130, take it if h >= 2^130-5, in constant time*/
+  g0 = h0+5; c = g0>>26; g0 &= AEAD_MASK26;
+  g1 = h1+c; c = g1>>26; g1 &= AEAD_MASK26;
+  g2 = h2+c; c = g2>>26; g2 &= AEAD_MASK26;
+  g3 = h3+c; c = g3>>26; g3 &= AEAD_MASK26;
+  g4 = h4+c-(1u<<26);
+
+  mask = (g4>>31)-1u;
+  h0 = (h0&~mask)|(g0&mask);
+  h1 = (h1&~mask)|(g1&mask);
+  h2 = (h2&~mask)|(g2&mask);
+  h3 = (h3&~mask)|(g3&mask);
+  h4 = (h4&~mask)|(g4&mask);
+
+  /* h mod 2^128 + pad*/
+  uint64_t f;
+
+  h0 = (h0    )|(h1<<26);
+  h1 = (h1>>6 )|(h2<<20);
+  h2 = (h2>>12)|(h3<<14);
+  h3 = (h3>>18)|(h4<<8);
+
+  f = (uint64_t)h0+poly->pad[0];          _this_store32(tag+0, (uint32_t)f);
+  f = (uint64_t)h1+poly->pad[1]+(f>>32);  _this_store32(tag+4, (uint32_t)f);
+  f = (uint64_t)h2+poly->pad[2]+(f>>32);  _this_store32(tag+8, (uint32_t)f);
+  f = (uint64_t)h3+poly->pad[3]+(f>>32);  _this_store32(tag+12,(uint32_t)f);
+
+  _this_wipe(poly,sizeof(sAeadPoly_t));
+}
+
+/**
+ * @brief RFC 8439 tag over additional data and ciphertext
+ *
+ * @param state   ChaCha20 state
+ * @param aad     additional data
+ * @param aad_len additional data size
+ * @param data    ciphertext
+ * @param len     ciphertext size
+ * @param tag     output @ref INTERFACE_AEAD_TAG_SIZE bytes
+ */
+static void _this_mac(uint32_t* state,const uint8_t* aad,size_t aad_len,const uint8_t* data,size_t len,uint8_t* tag)
+{
+  sAeadPoly_t poly;
+
+  _this_poly_init(&poly,state);
+  if(aad_len != 0)
+    _this_poly_pad(&poly,aad,aad_len);
+  _this_poly_pad(&poly,data,len);
+  _this_poly_finish(&poly,aad_len,len,tag);
+}
+
+/**
+ * @brief Compare in constant time
+ *
+ * @param a   first buffer
+ * @param b   second buffer
+ * @param len size
+ * @return true   if equal
+ * @return false  else
+ */
+static bool _this_equal(const uint8_t* a,const uint8_t* b,size_t len)
+{
+  uint8_t diff = 0;
+
+  for(size_t i = 0;i<len;i++)
+    diff |= a[i]^b[i];
+
+  return diff == 0;
+}
+
+/**
+ * @brief Clear secret data, not optimized away
+ *
+ * @param data pointer to data
+ * @param len  size
+ */
+static void _this_wipe(void* data,size_t len)
+{
+  volatile uint8_t* p = (volatile uint8_t*)data;
+
+  while(len--)
+    *p++ = 0;
+}
+
+/**
+ * @brief Frame nonce: direction id, sequence
+ *
+ * @param nonce output @ref INTERFACE_AEAD_NONCE_SIZE bytes
+ * @param id    direction id
+ * @param seq   frame sequence
+ */
+static void _this_nonce(uint8_t* nonce,uint32_t id,uint64_t seq)
+{
+  _this_store32(nonce,id);
+  _this_store64(nonce+4,seq);
+}
+
+/**
+ * @brief Check sequence against replay window
+ *
+ * @param cthis pointer to @ref InterfaceAead_t
+ * @param seq   frame sequence
+ * @return true   if new
+ * @return false  if seen or older than window
+ */
+static bool _this_replay_check(const InterfaceAead_t* cthis,uint64_t seq)
+{
+  if(seq > cthis->RxTop)
+    return seq != AEAD_SEQ_LAST;
+
+  uint64_t age = cthis->RxTop-seq;
+
+  return (age < cthis->Window)&&!((cthis->RxMask>>age)&1u);
+}
+
+/**
+ * @brief Mark authenticated sequence in replay window
+ *
+ * @param cthis pointer to @ref InterfaceAead_t
+ * @param seq   frame sequence, passed @ref _this_replay_check
+ */
+static void _this_replay_update(InterfaceAead_t* cthis,uint64_t seq)
+{
+  if(seq > cthis->RxTop)
+  {
+    uint64_t shift = seq-cthis->RxTop;
+
+    cthis->RxMask = (shift < 64) ? (cthis->RxMask<<shift)|1u : 1u;
+    cthis->RxTop  = seq;
+  }
+  else
+    cthis->RxMask |= (uint64_t)1u<<(cthis->RxTop-seq);
+}
+
+/** @}*/
@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceAead.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceAead.c (ChaCha20-Poly1305 frame stage)
+  * @version  V1.0.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_AEAD_H__
+#define __INTERFACE_AEAD_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Interface.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Aead Interface authenticated encryption
+ * @brief    ChaCha20-Poly1305 (RFC 8439) pipeline stage
+ * @details  Frame on the wire: 64-bit little endian sequence, ciphertext,
+ *           16 byte tag. The nonce is the 32-bit direction id of the sender
+ *           followed by the sequence, so both ends may share one key as long
+ *           as their TxId differ. The sequence is counted per frame and never
+ *           reused under one key. Rx keeps a sliding replay window: frames
+ *           older than the window or seen before are dropped, as are frames
+ *           with a bad tag, before the rx filter and the parent callback.
+ * @note     With @ref Interface_InstallCompress the payload is compressed before
+ *           the stage and decompressed after it (fixed pipeline order), so the
+ *           combination works. Compressed size still shows on the wire: do not
+ *           compress frames that mix secrets with peer controlled data.
+ * @{
+ */
+
+#define INTERFACE_AEAD_KEY_SIZE   32u   /*!< Key size*/
+#define INTERFACE_AEAD_NONCE_SIZE 12u   /*!< RFC 8439 nonce size*/
+#define INTERFACE_AEAD_SEQ_SIZE   8u    /*!< Frame sequence size*/
+#define INTERFACE_AEAD_TAG_SIZE   16u   /*!< Frame tag size*/
+#define INTERFACE_AEAD_OVERHEAD   (INTERFACE_AEAD_SEQ_SIZE+INTERFACE_AEAD_TAG_SIZE) /*!< Frame growth*/
+#define INTERFACE_AEAD_WINDOW     64u   /*!< Max replay window in frames*/
+
+/**
+ * @brief AEAD stage configuration
+ *
+ */
+typedef struct
+{
+  uint8_t   Key[INTERFACE_AEAD_KEY_SIZE]; /*!< Shared key*/
+  uint32_t  TxId;     /*!< Direction id of this end, put in tx nonces*/
+  uint32_t  RxId;     /*!< Direction id of the peer, expected in rx nonces*/
+  uint8_t   Window;   /*!< Replay window in frames (1..@ref INTERFACE_AEAD_WINDOW), 0 - max*/
+}sInterfaceAeadCfg_t;
+
+/**
+ * @brief AEAD statistic
+ *
+ */
+typedef struct
+{
+  uint32_t  TxFrames;   /*!< Frames sealed*/
+  uint32_t  TxRefused;  /*!< Frames not sealed: no room or sequence exhausted*/
+  uint32_t  RxFrames;   /*!< Frames opened*/
+  uint32_t  RxShort;    /*!< Frames shorter than the overhead*/
+  uint32_t  RxAuthFail; /*!< Frames with bad tag*/
+  uint32_t  RxReplay;   /*!< Frames seen before or older than the window*/
+}sInterfaceAeadStats_t;
+
+/**
+ * @defgroup Interface_Aead_public_func Interface authenticated encryption public function
+ * @{
+ */
+  InterfaceAead_t*    InterfaceAead_ctor(const sInterfaceAeadCfg_t* cfg);
+  void                InterfaceAead_dtor(InterfaceAead_t* cthis);
+
+  void                InterfaceAead_Rekey(InterfaceAead_t* cthis,const uint8_t* key);
+  void                InterfaceAead_GetStage(InterfaceAead_t* cthis,sInterfaceStage_t* stage);
+  uint64_t            InterfaceAead_GetTxSeq(InterfaceAead_t* cthis);
+
+  size_t              InterfaceAead_Seal(void* parent,uint8_t* dst,const uint8_t* src,size_t size,size_t dst_max);
+  size_t              InterfaceAead_Open(void* parent,uint8_t* dst,const uint8_t* src,size_t size,size_t dst_max);
+
+  void                InterfaceAead_Encrypt(const uint8_t* key,const uint8_t* nonce,const uint8_t* aad,size_t aad_len,
+                                            uint8_t* dst,const uint8_t* src,size_t len,uint8_t* tag);
+  bool                InterfaceAead_Decrypt(const uint8_t* key,const uint8_t* nonce,const uint8_t* aad,size_t aad_len,
+                                            uint8_t* dst,const uint8_t* src,size_t len,const uint8_t* tag);
+
+  void                InterfaceAead_GetStats(InterfaceAead_t* cthis,sInterfaceAeadStats_t* stats);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
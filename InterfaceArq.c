@@ -0,0 +1,640 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceArq.c
+ * @author   Wyrm
+ * @brief    Selective-repeat sliding window reliability layer on top of @ref InterfaceHandel_t
+ * @version  V1.1.1
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Create the layer with InterfaceArq_ctor() and link it by Interface_InstallArq()
+  2. Send with InterfaceArq_Send(), received frames are delivered in order
+     through the usual Interface path (parent callback or Interface_readData())
+  3. Call InterfaceArq_process() periodically (Interface_process() does it in process mode)
+  4. Interface keeps received frames in the window while its rx queue is full and
+     advertises the room left (InterfaceArq_SetRxRoom()), peer sends no more than that
+  @note in kInterfaceRxTx_irq mode call InterfaceArq_Send()/InterfaceArq_process()
+        inside Rx critical section, ack handling runs from the Rx irq
+*/
+
+
+#include <string.h>
+
+#include "wheap.h"
+
+#include "InterfaceArq.h"
+
+
+/**
+ * @addtogroup Interface_Arq
+ * @{
+ */
+
+/* Private macro -------------------------------------------------------------*/
+#define ARQ_TYPE_DATA   0x01u
+#define ARQ_TYPE_ACK    0x02u
+
+#define ARQ_CRC_SPARE   4u    /*!< Interface_SendData appends crc right after payload*/
+#define ARQ_DUP_THRESH  3u    /*!< Frames acked above a hole before it is resent*/
+
+#define ARQ_SEQ_DIFF(a,b) ((int16_t)(uint16_t)((a)-(b)))
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Send window slot
+ *
+ */
+typedef struct
+{
+  uint8_t*  Buff;       /*!< header + payload + crc spare*/
+  size_t    Len;        /*!< header + payload*/
+  uint32_t  SentTick;   /*!< last transmission tick*/
+  uint32_t  Rto;        /*!< slot timeout with backoff*/
+  uint8_t   Retries;
+  bool      Used;
+  bool      Sent;
+  bool      Acked;
+  bool      FastRetx;
+}sArqTxSlot_t;
+
+/**
+ * @brief Receive window slot
+ *
+ */
+typedef struct
+{
+  uint8_t*  Buff;
+  size_t    Len;
+  bool      Present;
+}sArqRxSlot_t;
+
+/**
+ * @brief InterfaceArq Class
+ *
+ */
+struct InterfaceArq
+{
+  InterfaceHandel_t*  Iface;
+  sInterfaceArqCfg_t  Cfg;
+
+  sArqTxSlot_t*       TxSlot;
+  uint16_t            SndUna;     /*!< oldest unacked sequence*/
+  uint16_t            SndNxt;     /*!< next sequence to send*/
+
+  sArqRxSlot_t*       RxSlot;
+  uint16_t            RcvNxt;     /*!< next expected sequence*/
+  size_t              RxRoom;     /*!< frames the receiver queue can take, see InterfaceArq_SetRxRoom*/
+  uint8_t             RxAdv;      /*!< last advertised receive window*/
+  uint8_t             PeerWnd;    /*!< receive window advertised by peer*/
+
+  uint32_t            Srtt;       /*!< smoothed rtt << 3*/
+  uint32_t            Rttvar;     /*!< rtt variance << 2*/
+  uint32_t            Rto;
+  bool                RttValid;
+
+  uint8_t             AckBuff[INTERFACE_ARQ_HEAD_SIZE+ARQ_CRC_SPARE];
+
+  sInterfaceArqStats_t Stats;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Arq_Private_Functions Interface reliability layer private functions
+  * @{
+  */
+  static uint32_t _this_now(const InterfaceArq_t* cthis);
+  static uint16_t _this_rcv_ack(const InterfaceArq_t* cthis);
+  static uint8_t  _this_rcv_wnd(const InterfaceArq_t* cthis,uint16_t ack);
+  static void     _this_head_fill(InterfaceArq_t* cthis,uint8_t* dst,uint8_t type,uint16_t seq);
+  static void     _this_send_ack(InterfaceArq_t* cthis);
+  static bool     _this_transmit(InterfaceArq_t* cthis,sArqTxSlot_t* slot);
+  static void     _this_rtt_sample(InterfaceArq_t* cthis,uint32_t rtt);
+  static void     _this_ack_slot(InterfaceArq_t* cthis,uint16_t seq);
+  static void     _this_ack_input(InterfaceArq_t* cthis,uint16_t ack,uint32_t sack);
+/** @}*/
+
+
+/**
+ * @brief InterfaceArq Class constructor
+ *
+ * @param iface pointer to @ref InterfaceHandel_t transport
+ * @param cfg   pointer to @ref sInterfaceArqCfg_t configuration
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceArq_t* InterfaceArq_ctor(InterfaceHandel_t* iface,const sInterfaceArqCfg_t* cfg)
+{
+  if((iface == NULL)||(cfg == NULL)||(cfg->Clock.func == NULL))
+    return NULL;
+  if((cfg->Window == 0)||(cfg->Window > INTERFACE_ARQ_MAX_WINDOW)||(cfg->MaxPayload == 0))
+    return NULL;
+  if(cfg->Window & (cfg->Window-1))
+    return NULL; /* slot index must survive sequence wrap*/
+
+  InterfaceArq_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceArq_t)) == NULL)
+    return NULL;
+  memset(cthis,0,sizeof(InterfaceArq_t));
+
+  cthis->Iface = iface;
+  cthis->Cfg   = *cfg;
+
+  if(cthis->Cfg.RtoMin == 0)
+    cthis->Cfg.RtoMin = 1;
+  if(cthis->Cfg.RtoMax < cthis->Cfg.RtoMin)
+    cthis->Cfg.RtoMax = cthis->Cfg.RtoMin;
+  if(cthis->Cfg.RtoInit < cthis->Cfg.RtoMin)
+    cthis->Cfg.RtoInit = cthis->Cfg.RtoMin;
+
+  cthis->Rto     = cthis->Cfg.RtoInit;
+  cthis->RxRoom  = cfg->Window;
+  cthis->RxAdv   = (uint8_t)cfg->Window;
+  cthis->PeerWnd = (uint8_t)cfg->Window;
+
+  size_t slot_size = INTERFACE_ARQ_HEAD_SIZE+cfg->MaxPayload+ARQ_CRC_SPARE;
+
+  cthis->TxSlot = heap_malloc(cfg->Window*sizeof(sArqTxSlot_t));
+  cthis->RxSlot = heap_malloc(cfg->Window*sizeof(sArqRxSlot_t));
+  if((cthis->TxSlot == NULL)||(cthis->RxSlot == NULL))
+  {
+    InterfaceArq_dtor(cthis);
+    return NULL;
+  }
+  memset(cthis->TxSlot,0,cfg->Window*sizeof(sArqTxSlot_t));
+  memset(cthis->RxSlot,0,cfg->Window*sizeof(sArqRxSlot_t));
+
+  for(size_t i = 0;i<cfg->Window;i++)
+  {
+    cthis->TxSlot[i].Buff = heap_malloc(slot_size);
+    cthis->RxSlot[i].Buff = heap_malloc(cfg->MaxPayload);
+    if((cthis->TxSlot[i].Buff == NULL)||(cthis->RxSlot[i].Buff == NULL))
+    {
+      InterfaceArq_dtor(cthis);
+      return NULL;
+    }
+  }
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceArq class destructor
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ */
+void InterfaceArq_dtor(InterfaceArq_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  for(size_t i = 0;i<cthis->Cfg.Window;i++)
+  {
+    if(cthis->TxSlot)
+      heap_free(cthis->TxSlot[i].Buff);
+    if(cthis->RxSlot)
+      heap_free(cthis->RxSlot[i].Buff);
+  }
+  heap_free(cthis->TxSlot);
+  heap_free(cthis->RxSlot);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Check is there free place in the send window
+ * @note  window is limited by the one advertised by peer, one frame is always
+ *        allowed so a closed peer window is probed by retransmission
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @return true   if @ref InterfaceArq_Send can accept frame
+ * @return false  window full
+ */
+bool InterfaceArq_IsTxFree(InterfaceArq_t* cthis)
+{
+  size_t wnd = (cthis->PeerWnd != 0) ? cthis->PeerWnd : 1;
+
+  return (uint16_t)(cthis->SndNxt-cthis->SndUna) < wnd;
+}
+
+/**
+ * @brief Check is every sent frame acknowledged
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @return true   if send window empty
+ * @return false  else
+ */
+bool InterfaceArq_IsTxIdle(InterfaceArq_t* cthis)
+{
+  return cthis->SndNxt == cthis->SndUna;
+}
+
+/**
+ * @brief Queue frame to the send window and transmit it
+ * @note  frame stays in window until acknowledged, it is resent on timeout
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @param data  pointer to payload
+ * @param leng  payload size (<= MaxPayload)
+ * @return true   if frame accepted
+ * @return false  window full or frame too big
+ */
+bool InterfaceArq_Send(InterfaceArq_t* cthis,const void* data,size_t leng)
+{
+  if((cthis == NULL)||(leng == 0)||(leng > cthis->Cfg.MaxPayload))
+    return false;
+  if(!InterfaceArq_IsTxFree(cthis))
+    return false;
+
+  sArqTxSlot_t* slot = &cthis->TxSlot[cthis->SndNxt%cthis->Cfg.Window];
+
+  memcpy(slot->Buff+INTERFACE_ARQ_HEAD_SIZE,data,leng);
+  slot->Len       = INTERFACE_ARQ_HEAD_SIZE+leng;
+  slot->Rto       = cthis->Rto;
+  slot->Retries   = 0;
+  slot->Used      = true;
+  slot->Sent      = false;
+  slot->Acked     = false;
+  slot->FastRetx  = false;
+  /* seq is fixed now, ack fields are refreshed on every transmission*/
+  slot->Buff[2] = (uint8_t)(cthis->SndNxt);
+  slot->Buff[3] = (uint8_t)(cthis->SndNxt>>8);
+
+  cthis->SndNxt++;
+  cthis->Stats.TxFrames++;
+
+  _this_transmit(cthis,slot); /* if HW and tx queue are busy, process() will retry*/
+
+  return true;
+}
+
+/**
+ * @brief Input frame received by interface
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @param src   pointer to frame (after unpack, filter, crc)
+ * @param leng  frame size
+ * @return true   if data frame became deliverable, call @ref InterfaceArq_Pop
+ * @return false  else
+ */
+bool InterfaceArq_Input(InterfaceArq_t* cthis,const uint8_t* src,size_t leng)
+{
+  if((cthis == NULL)||(leng < INTERFACE_ARQ_HEAD_SIZE))
+    return false;
+
+  uint8_t  type = src[0];
+  uint16_t seq  = (uint16_t)(src[2]|(src[3]<<8));
+  uint16_t ack  = (uint16_t)(src[4]|(src[5]<<8));
+  uint32_t sack = (uint32_t)src[6]|((uint32_t)src[7]<<8)|((uint32_t)src[8]<<16)|((uint32_t)src[9]<<24);
+
+  if((type != ARQ_TYPE_DATA)&&(type != ARQ_TYPE_ACK))
+    return false;
+
+  if(ARQ_SEQ_DIFF(ack,cthis->SndUna) >= 0) /* reordered old frame must not reopen window*/
+    cthis->PeerWnd = (src[1] < cthis->Cfg.Window) ? src[1] : (uint8_t)cthis->Cfg.Window;
+
+  _this_ack_input(cthis,ack,sack);
+
+  if(type == ARQ_TYPE_ACK)
+    return false;
+
+  size_t   pay  = leng-INTERFACE_ARQ_HEAD_SIZE;
+  int16_t  diff = ARQ_SEQ_DIFF(seq,cthis->RcvNxt);
+
+  if((pay == 0)||(pay > cthis->Cfg.MaxPayload)||(diff >= (int16_t)cthis->Cfg.Window))
+  {
+    cthis->Stats.RxOutOfWindow++;
+  }
+  else if(diff < 0)
+  {
+    cthis->Stats.RxDuplicates++; /* our ack was lost, ack it again*/
+  }
+  else
+  {
+    sArqRxSlot_t* slot = &cthis->RxSlot[seq%cthis->Cfg.Window];
+    if(slot->Present)
+      cthis->Stats.RxDuplicates++;
+    else
+    {
+      memcpy(slot->Buff,src+INTERFACE_ARQ_HEAD_SIZE,pay);
+      slot->Len     = pay;
+      slot->Present = true;
+      cthis->Stats.RxFrames++;
+    }
+  }
+
+  _this_send_ack(cthis);
+
+  return cthis->RxSlot[cthis->RcvNxt%cthis->Cfg.Window].Present;
+}
+
+/**
+ * @brief Pop next in order frame
+ * @note  returned pointer is valid until next @ref InterfaceArq_Input call
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @param dst   pointer to data pointer
+ * @return size_t payload size, 0 if no in order frame
+ */
+size_t InterfaceArq_Pop(InterfaceArq_t* cthis,uint8_t** dst)
+{
+  sArqRxSlot_t* slot = &cthis->RxSlot[cthis->RcvNxt%cthis->Cfg.Window];
+
+  if(!slot->Present)
+    return 0;
+
+  slot->Present = false;
+  cthis->RcvNxt++;
+  cthis->Stats.Delivered++;
+
+  (*dst) = slot->Buff;
+  return slot->Len;
+}
+
+/**
+ * @brief Set how many frames the receiver queue can take now
+ * @details in order frames stay in the receive window (acked, not popped) while
+ *          the queue is full, the advertised window shrinks by them. Ack is sent
+ *          when closed window opens again
+ * @param cthis  pointer to @ref InterfaceArq_t
+ * @param frames free frames in receiver queue
+ */
+void InterfaceArq_SetRxRoom(InterfaceArq_t* cthis,size_t frames)
+{
+  cthis->RxRoom = frames;
+
+  if((cthis->RxAdv == 0)&&(_this_rcv_wnd(cthis,_this_rcv_ack(cthis)) != 0))
+    _this_send_ack(cthis);
+}
+
+/**
+ * @brief ARQ none blocking process, retransmit timed out frames
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ */
+void InterfaceArq_process(InterfaceArq_t* cthis)
+{
+  uint32_t now = _this_now(cthis);
+
+  for(uint16_t seq = cthis->SndUna;seq != cthis->SndNxt;seq++)
+  {
+    sArqTxSlot_t* slot = &cthis->TxSlot[seq%cthis->Cfg.Window];
+
+    if(slot->Acked)
+      continue;
+
+    if(!slot->Sent)
+    {
+      if(!_this_transmit(cthis,slot))
+        return; /* tx path still busy, keep order*/
+      continue;
+    }
+
+    if((uint32_t)(now-slot->SentTick) < slot->Rto)
+      continue;
+
+    /* RFC 6298 5.5/5.7: back off the timeout of new frames too, and keep it
+       until a valid rtt sample, frames timed out together back it off once*/
+    if(slot->Rto >= cthis->Rto)
+      cthis->Rto = (cthis->Rto > cthis->Cfg.RtoMax/2) ? cthis->Cfg.RtoMax : cthis->Rto*2;
+
+    slot->Retries++;
+    slot->Rto = (slot->Rto > cthis->Cfg.RtoMax/2) ? cthis->Cfg.RtoMax : slot->Rto*2;
+    cthis->Stats.Retransmits++;
+
+    if(!_this_transmit(cthis,slot))
+      return;
+  }
+}
+
+/**
+ * @brief Get ARQ statistic
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @param stats pointer to output @ref sInterfaceArqStats_t
+ */
+void InterfaceArq_GetStats(InterfaceArq_t* cthis,sInterfaceArqStats_t* stats)
+{
+  cthis->Stats.Srtt = cthis->Srtt>>3;
+  cthis->Stats.Rto  = cthis->Rto;
+  *stats = cthis->Stats;
+}
+
+/**
+ * @brief Get clock tick
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @return uint32_t current tick
+ */
+static uint32_t _this_now(const InterfaceArq_t* cthis)
+{
+  return cthis->Cfg.Clock.func(cthis->Cfg.Clock.parent);
+}
+
+/**
+ * @brief Get cumulative ack
+ * @note  in order frames waiting for @ref InterfaceArq_Pop are acked too, ack is
+ *        sent from @ref InterfaceArq_Input before they are popped
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @return uint16_t next sequence not received in order
+ */
+static uint16_t _this_rcv_ack(const InterfaceArq_t* cthis)
+{
+  uint16_t ack = cthis->RcvNxt;
+
+  while(((uint16_t)(ack-cthis->RcvNxt) < cthis->Cfg.Window)&&cthis->RxSlot[ack%cthis->Cfg.Window].Present)
+    ack++;
+
+  return ack;
+}
+
+/**
+ * @brief Get receive window to advertise
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @param ack   cumulative ack
+ * @return uint8_t receiver queue room left after in order frames not popped yet
+ */
+static uint8_t _this_rcv_wnd(const InterfaceArq_t* cthis,uint16_t ack)
+{
+  size_t held = (uint16_t)(ack-cthis->RcvNxt);
+  size_t wnd  = (cthis->RxRoom > held) ? cthis->RxRoom-held : 0;
+
+  return (uint8_t)((wnd < cthis->Cfg.Window) ? wnd : cthis->Cfg.Window);
+}
+
+/**
+ * @brief Fill frame header, ack fields describe current receive window
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @param dst   pointer to header
+ * @param type  frame type
+ * @param seq   frame sequence
+ */
+static void _this_head_fill(InterfaceArq_t* cthis,uint8_t* dst,uint8_t type,uint16_t seq)
+{
+  uint32_t sack = 0;
+  uint16_t ack  = _this_rcv_ack(cthis);
+
+  for(uint32_t i = 1;((uint16_t)(ack-cthis->RcvNxt)+i < cthis->Cfg.Window)&&(i <= 32);i++)
+  {
+    if(cthis->RxSlot[(uint16_t)(ack+i)%cthis->Cfg.Window].Present)
+      sack |= 1ul<<(i-1);
+  }
+
+  cthis->RxAdv = _this_rcv_wnd(cthis,ack);
+
+  dst[0] = type;
+  dst[1] = cthis->RxAdv;
+  dst[2] = (uint8_t)(seq);
+  dst[3] = (uint8_t)(seq>>8);
+  dst[4] = (uint8_t)(ack);
+  dst[5] = (uint8_t)(ack>>8);
+  dst[6] = (uint8_t)(sack);
+  dst[7] = (uint8_t)(sack>>8);
+  dst[8] = (uint8_t)(sack>>16);
+  dst[9] = (uint8_t)(sack>>24);
+}
+
+/**
+ * @brief Send standalone ack
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ */
+static void _this_send_ack(InterfaceArq_t* cthis)
+{
+  _this_head_fill(cthis,cthis->AckBuff,ARQ_TYPE_ACK,0);
+
+  if(Interface_SendData(cthis->Iface,cthis->AckBuff,INTERFACE_ARQ_HEAD_SIZE))
+    cthis->Stats.AcksSent++;
+}
+
+/**
+ * @brief (Re)transmit window slot with fresh piggybacked ack
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @param slot  pointer to slot
+ * @return true   if frame accepted by interface
+ * @return false  interface busy
+ */
+static bool _this_transmit(InterfaceArq_t* cthis,sArqTxSlot_t* slot)
+{
+  uint16_t seq = (uint16_t)(slot->Buff[2]|(slot->Buff[3]<<8));
+
+  _this_head_fill(cthis,slot->Buff,ARQ_TYPE_DATA,seq);
+
+  if(!Interface_SendData(cthis->Iface,slot->Buff,slot->Len))
+    return false;
+
+  slot->Sent     = true;
+  slot->SentTick = _this_now(cthis);
+  return true;
+}
+
+/**
+ * @brief Update rtt estimation (RFC 6298)
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @param rtt   measured round trip time
+ */
+static void _this_rtt_sample(InterfaceArq_t* cthis,uint32_t rtt)
+{
+  if(!cthis->RttValid)
+  {
+    cthis->Srtt   = rtt<<3;
+    cthis->Rttvar = rtt<<1;
+    cthis->RttValid = true;
+  }
+  else
+  {
+    int32_t err = (int32_t)rtt-(int32_t)(cthis->Srtt>>3);
+    cthis->Srtt += err;
+    if(err < 0)
+      err = -err;
+    cthis->Rttvar += err-(int32_t)(cthis->Rttvar>>2);
+  }
+
+  uint32_t rto = (cthis->Srtt>>3)+cthis->Rttvar;
+
+  if(rto < cthis->Cfg.RtoMin)
+    rto = cthis->Cfg.RtoMin;
+  if(rto > cthis->Cfg.RtoMax)
+    rto = cthis->Cfg.RtoMax;
+
+  cthis->Rto = rto;
+}
+
+/**
+ * @brief Mark sent frame acknowledged
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @param seq   frame sequence
+ */
+static void _this_ack_slot(InterfaceArq_t* cthis,uint16_t seq)
+{
+  sArqTxSlot_t* slot = &cthis->TxSlot[seq%cthis->Cfg.Window];
+
+  if(!slot->Used||slot->Acked||!slot->Sent)
+    return;
+
+  slot->Acked = true;
+
+  if(slot->Retries == 0 && !slot->FastRetx) /* Karn: no sample from resent frames*/
+    _this_rtt_sample(cthis,_this_now(cthis)-slot->SentTick);
+}
+
+/**
+ * @brief Process cumulative and selective ack
+ *
+ * @param cthis pointer to @ref InterfaceArq_t
+ * @param ack   next sequence expected by peer
+ * @param sack  bitmap of received frames after ack
+ */
+static void _this_ack_input(InterfaceArq_t* cthis,uint16_t ack,uint32_t sack)
+{
+  uint16_t inflight = (uint16_t)(cthis->SndNxt-cthis->SndUna);
+
+  if((uint16_t)(ack-cthis->SndUna) > inflight)
+    return; /* stale or bogus ack*/
+
+  for(uint16_t seq = cthis->SndUna;seq != ack;seq++)
+    _this_ack_slot(cthis,seq);
+
+  uint32_t sacked = 0;
+  uint32_t i      = 0;
+
+  for(;(i < 32)&&((uint16_t)(ack+1+i-cthis->SndUna) < inflight);i++)
+  {
+    if(sack & (1ul<<i))
+    {
+      _this_ack_slot(cthis,(uint16_t)(ack+1+i));
+      sacked++;
+    }
+  }
+  if(i < 32)
+    sack &= (1ul<<i)-1; /* ignore bits beyond what we have sent*/
+
+  /* hole with ARQ_DUP_THRESH frames acked above it is lost, not reordered: resend once without waiting rto*/
+  for(i = 0;sacked >= ARQ_DUP_THRESH;i++)
+  {
+    if((i > 0)&&(sack & (1ul<<(i-1))))
+    {
+      sacked--;
+      continue;
+    }
+    sArqTxSlot_t* slot = &cthis->TxSlot[(uint16_t)(ack+i)%cthis->Cfg.Window];
+    if(slot->Acked||!slot->Sent||slot->FastRetx)
+      continue;
+    slot->FastRetx = true;
+    if(_this_transmit(cthis,slot))
+      cthis->Stats.FastRetransmits++;
+  }
+
+  while((cthis->SndUna != cthis->SndNxt)&&cthis->TxSlot[cthis->SndUna%cthis->Cfg.Window].Acked)
+  {
+    cthis->TxSlot[cthis->SndUna%cthis->Cfg.Window].Used = false;
+    cthis->SndUna++;
+  }
+}
+
+/** @}*/
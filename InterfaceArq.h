@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceArq.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceArq.c (selective-repeat reliability layer)
+  * @version  V1.1.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_ARQ_H__
+#define __INTERFACE_ARQ_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Interface.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Arq Interface reliability layer
+ * @brief    Selective-repeat ARQ between @ref Interface_SendData / rx parser and the application
+ * @details  Every frame carries @ref INTERFACE_ARQ_HEAD_SIZE bytes of header:
+ *           type, receive window, sequence number, cumulative ack and a 32-bit selective ack bitmap.
+ *           Receive window is the receiver queue room, sender keeps in flight no more than that.
+ *           Acks are piggybacked on data frames and sent standalone on every received data frame.
+ *           Retransmit timeout is adaptive (SRTT/RTTVAR, Karn's rule, exponential backoff).
+ * @{
+ */
+
+#define INTERFACE_ARQ_HEAD_SIZE   10u   /*!< ARQ header size in bytes*/
+#define INTERFACE_ARQ_MAX_WINDOW  32u   /*!< Max window, limited by selective ack bitmap*/
+
+/**
+ * @brief ARQ configuration
+ *
+ */
+typedef struct
+{
+  size_t    Window;       /*!< Send/receive window in frames, power of two up to @ref INTERFACE_ARQ_MAX_WINDOW*/
+  size_t    MaxPayload;   /*!< Max user payload per frame*/
+  uint32_t  RtoInit;      /*!< Initial retransmit timeout in clock ticks*/
+  uint32_t  RtoMin;       /*!< Min retransmit timeout in clock ticks*/
+  uint32_t  RtoMax;       /*!< Max retransmit timeout in clock ticks*/
+  sInterfaceClock_t Clock;/*!< Monotonic clock*/
+}sInterfaceArqCfg_t;
+
+/**
+ * @brief ARQ statistic
+ *
+ */
+typedef struct
+{
+  uint32_t  TxFrames;       /*!< New data frames sent*/
+  uint32_t  Retransmits;    /*!< Frames resent on timeout*/
+  uint32_t  FastRetransmits;/*!< Frames resent on selective ack hole*/
+  uint32_t  AcksSent;       /*!< Standalone ack frames*/
+  uint32_t  RxFrames;       /*!< Data frames accepted into window*/
+  uint32_t  RxDuplicates;   /*!< Data frames already received*/
+  uint32_t  RxOutOfWindow;  /*!< Data frames beyond the window*/
+  uint32_t  Delivered;      /*!< Frames delivered in order to application*/
+  uint32_t  Srtt;           /*!< Smoothed round trip time in ticks*/
+  uint32_t  Rto;            /*!< Current retransmit timeout in ticks*/
+}sInterfaceArqStats_t;
+
+/**
+ * @defgroup Interface_Arq_public_func Interface reliability layer public function
+ * @{
+ */
+  InterfaceArq_t*     InterfaceArq_ctor(InterfaceHandel_t* iface,const sInterfaceArqCfg_t* cfg);
+  void                InterfaceArq_dtor(InterfaceArq_t* cthis);
+
+  bool                InterfaceArq_Send(InterfaceArq_t* cthis,const void* data,size_t leng);
+  bool                InterfaceArq_IsTxFree(InterfaceArq_t* cthis);
+  bool                InterfaceArq_IsTxIdle(InterfaceArq_t* cthis);
+
+  bool                InterfaceArq_Input(InterfaceArq_t* cthis,const uint8_t* src,size_t leng);
+  size_t              InterfaceArq_Pop(InterfaceArq_t* cthis,uint8_t** dst);
+  void                InterfaceArq_SetRxRoom(InterfaceArq_t* cthis,size_t frames);
+
+  void                InterfaceArq_process(InterfaceArq_t* cthis);
+  void                InterfaceArq_GetStats(InterfaceArq_t* cthis,sInterfaceArqStats_t* stats);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
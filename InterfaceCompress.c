@@ -0,0 +1,410 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceCompress.c
+ * @author   Wyrm
+ * @brief    Lightweight LZ4-class frame compression for @ref InterfaceHandel_t
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Create the class with InterfaceCompress_ctor(IntBuffSize) and link it by
+     Interface_InstallCompress() on both sides of the link
+  2. Interface_SendData() compresses payload before pipeline stages, crc and pack,
+     rx parser decompresses after unpack, crc check and stages, rx filter sees
+     plain data
+  3. InterfaceCompress_Block()/InterfaceCompress_Unblock() can be used standalone
+*/
+
+
+#include <string.h>
+
+#include "wheap.h"
+
+#include "InterfaceCompress.h"
+
+
+/**
+ * @addtogroup Interface_Compress
+ * @{
+ */
+
+/* Private macro -------------------------------------------------------------*/
+#define LZ_MIN_MATCH    4u
+#define LZ_MAX_OFFSET   0xFFFFu
+#define LZ_HASH_SIZE    (1u<<INTERFACE_COMPRESS_HASH_BITS)
+#define LZ_CRC_SPARE    4u    /*!< Interface_SendData appends crc right after payload*/
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief InterfaceCompress Class
+ *
+ */
+struct InterfaceCompress
+{
+  size_t    MaxFrame;
+  uint8_t*  TxBuff;       /*!< flag + block + crc spare*/
+  uint8_t*  RxBuff;       /*!< decompressed frame*/
+  uint16_t  Table[LZ_HASH_SIZE];
+
+  sInterfaceCompressStats_t Stats;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Compress_Private_Functions Interface compression private functions
+  * @{
+  */
+  static inline uint32_t  _this_read32(const uint8_t* src);
+  static inline uint32_t  _this_hash(uint32_t seq);
+  static uint8_t*         _this_put_len(uint8_t* op,const uint8_t* oend,size_t len);
+  static uint8_t*         _this_put_seq(uint8_t* op,const uint8_t* oend,const uint8_t* lit,size_t lit_len,size_t offset,size_t match_len);
+/** @}*/
+
+
+/**
+ * @brief InterfaceCompress Class constructor
+ *
+ * @param MaxFrame max frame size, usually IntBuffSize of @ref Interface_ctor
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceCompress_t* InterfaceCompress_ctor(size_t MaxFrame)
+{
+  if((MaxFrame == 0)||(MaxFrame > LZ_MAX_OFFSET))
+    return NULL;
+
+  InterfaceCompress_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceCompress_t)) == NULL)
+    return NULL;
+  memset(cthis,0,sizeof(InterfaceCompress_t));
+
+  cthis->MaxFrame = MaxFrame;
+  cthis->TxBuff = heap_malloc(INTERFACE_COMPRESS_HEAD_SIZE+MaxFrame+LZ_CRC_SPARE);
+  cthis->RxBuff = heap_malloc(MaxFrame);
+
+  if((cthis->TxBuff == NULL)||(cthis->RxBuff == NULL))
+  {
+    InterfaceCompress_dtor(cthis);
+    return NULL;
+  }
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceCompress class destructor
+ *
+ * @param cthis pointer to @ref InterfaceCompress_t
+ */
+void InterfaceCompress_dtor(InterfaceCompress_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  heap_free(cthis->TxBuff);
+  heap_free(cthis->RxBuff);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Compress frame, incompressible frame is passed raw
+ *
+ * @param cthis pointer to @ref InterfaceCompress_t
+ * @param dst   pointer to output pointer (internal buffer with crc spare)
+ * @param src   pointer to frame
+ * @param leng  frame size
+ * @return size_t output size with flag byte, 0 if frame too big
+ */
+size_t InterfaceCompress_Pack(InterfaceCompress_t* cthis,uint8_t** dst,const uint8_t* src,size_t leng)
+{
+  if(leng+INTERFACE_COMPRESS_HEAD_SIZE > cthis->MaxFrame)
+    return 0;
+
+  uint8_t* out = cthis->TxBuff;
+  size_t   blk = InterfaceCompress_Block(cthis->Table,out+INTERFACE_COMPRESS_HEAD_SIZE,leng-1,src,leng);
+
+  cthis->Stats.TxFrames++;
+  cthis->Stats.TxIn += leng;
+
+  if(blk == 0)
+  {
+    out[0] = INTERFACE_COMPRESS_RAW;
+    memcpy(out+INTERFACE_COMPRESS_HEAD_SIZE,src,leng);
+    blk = leng;
+    cthis->Stats.TxRaw++;
+  }
+  else
+    out[0] = INTERFACE_COMPRESS_LZ;
+
+  cthis->Stats.TxOut += INTERFACE_COMPRESS_HEAD_SIZE+blk;
+
+  (*dst) = out;
+  return INTERFACE_COMPRESS_HEAD_SIZE+blk;
+}
+
+/**
+ * @brief Decompress frame
+ * @note  raw frame is returned in place, without copy
+ * @param cthis pointer to @ref InterfaceCompress_t
+ * @param dst   pointer to output pointer
+ * @param src   pointer to received frame
+ * @param leng  received frame size
+ * @return size_t frame size, 0 if broken
+ */
+size_t InterfaceCompress_Unpack(InterfaceCompress_t* cthis,uint8_t** dst,const uint8_t* src,size_t leng)
+{
+  size_t out = 0;
+
+  if(leng > INTERFACE_COMPRESS_HEAD_SIZE)
+  {
+    switch(src[0])
+    {
+    case INTERFACE_COMPRESS_RAW:  (*dst) = (uint8_t*)src+INTERFACE_COMPRESS_HEAD_SIZE;
+                                  out = leng-INTERFACE_COMPRESS_HEAD_SIZE;
+                                  break;
+    case INTERFACE_COMPRESS_LZ:   (*dst) = cthis->RxBuff;
+                                  out = InterfaceCompress_Unblock(cthis->RxBuff,cthis->MaxFrame,src+INTERFACE_COMPRESS_HEAD_SIZE,leng-INTERFACE_COMPRESS_HEAD_SIZE);
+                                  break;
+    default:                      break;
+    }
+  }
+
+  if(out == 0)
+    cthis->Stats.RxErrors++;
+
+  return out;
+}
+
+/**
+ * @brief Compress block
+ *
+ * @param table   match finder table 2^@ref INTERFACE_COMPRESS_HASH_BITS entries
+ * @param dst     output buffer
+ * @param dst_max output buffer size
+ * @param src     input data (<= 64 KB)
+ * @param leng    input size
+ * @return size_t block size, 0 if it does not fit dst_max
+ */
+size_t InterfaceCompress_Block(uint16_t* table,uint8_t* dst,size_t dst_max,const uint8_t* src,size_t leng)
+{
+  const uint8_t* oend   = dst+dst_max;
+  uint8_t*       op     = dst;
+  size_t         anchor = 0;
+  size_t         ip     = 0;
+
+  if(leng > LZ_MAX_OFFSET+1)
+    return 0;
+
+  /* table is not cleared: stale entries are rejected by the 4 byte compare below*/
+  while(ip+LZ_MIN_MATCH <= leng)
+  {
+    uint32_t seq = _this_read32(src+ip);
+    uint32_t h   = _this_hash(seq);
+    size_t   ref = table[h];
+
+    table[h] = (uint16_t)ip;
+
+    if((ref >= ip)||(_this_read32(src+ref) != seq))
+    {
+      ip++;
+      continue;
+    }
+
+    size_t mlen = LZ_MIN_MATCH;
+    while((ip+mlen < leng)&&(src[ref+mlen] == src[ip+mlen]))
+      mlen++;
+
+    if((op = _this_put_seq(op,oend,src+anchor,ip-anchor,ip-ref,mlen)) == NULL)
+      return 0;
+
+    ip += mlen;
+    anchor = ip;
+  }
+
+  if(anchor < leng)
+  {
+    if((op = _this_put_seq(op,oend,src+anchor,leng-anchor,0,0)) == NULL)
+      return 0;
+  }
+
+  return (size_t)(op-dst);
+}
+
+/**
+ * @brief Decompress block
+ *
+ * @param dst     output buffer
+ * @param dst_max output buffer size
+ * @param src     block
+ * @param leng    block size
+ * @return size_t output size, 0 if block broken or does not fit dst_max
+ */
+size_t InterfaceCompress_Unblock(uint8_t* dst,size_t dst_max,const uint8_t* src,size_t leng)
+{
+  const uint8_t* ip   = src;
+  const uint8_t* iend = src+leng;
+  uint8_t*       op   = dst;
+  uint8_t*       oend = dst+dst_max;
+
+  while(ip < iend)
+  {
+    uint8_t token = *ip++;
+    size_t  len   = token>>4;
+
+    if(len == 15)
+    {
+      uint8_t b;
+      do
+      {
+        if(ip >= iend)
+          return 0;
+        b = *ip++;
+        len += b;
+      }while(b == 255);
+    }
+
+    if(((size_t)(iend-ip) < len)||((size_t)(oend-op) < len))
+      return 0;
+    memcpy(op,ip,len);
+    op += len;
+    ip += len;
+
+    if(ip == iend)
+      break; /* last sequence has literals only*/
+
+    if(iend-ip < 2)
+      return 0;
+    size_t offset = (size_t)ip[0]|((size_t)ip[1]<<8);
+    ip += 2;
+
+    len = (token&0x0F);
+    if(len == 15)
+    {
+      uint8_t b;
+      do
+      {
+        if(ip >= iend)
+          return 0;
+        b = *ip++;
+        len += b;
+      }while(b == 255);
+    }
+    len += LZ_MIN_MATCH;
+
+    if((offset == 0)||(offset > (size_t)(op-dst))||((size_t)(oend-op) < len))
+      return 0;
+
+    const uint8_t* ref = op-offset;
+    while(len--)
+      *op++ = *ref++; /* may overlap*/
+  }
+
+  return (size_t)(op-dst);
+}
+
+/**
+ * @brief Get compression statistic
+ *
+ * @param cthis pointer to @ref InterfaceCompress_t
+ * @param stats pointer to output @ref sInterfaceCompressStats_t
+ */
+void InterfaceCompress_GetStats(InterfaceCompress_t* cthis,sInterfaceCompressStats_t* stats)
+{
+  *stats = cthis->Stats;
+}
+
+/**
+ * @brief Unaligned 32-bit read
+ *
+ * @param src pointer to data
+ * @return uint32_t value
+ */
+static inline uint32_t _this_read32(const uint8_t* src)
+{
+  uint32_t v;
+  memcpy(&v,src,sizeof(v));
+  return v;
+}
+
+/**
+ * @brief Match finder hash (Knuth multiplicative)
+ *
+ * @param seq 4 bytes of input
+ * @return uint32_t table index
+ */
+static inline uint32_t _this_hash(uint32_t seq)
+{
+  return (seq*2654435761u)>>(32u-INTERFACE_COMPRESS_HASH_BITS);
+}
+
+/**
+ * @brief Put extended length bytes
+ *
+ * @param op    output pointer
+ * @param oend  output end
+ * @param len   length above 15
+ * @return uint8_t* new output pointer, NULL if no space
+ */
+static uint8_t* _this_put_len(uint8_t* op,const uint8_t* oend,size_t len)
+{
+  while(len >= 255)
+  {
+    if(op >= oend)
+      return NULL;
+    *op++ = 255;
+    len -= 255;
+  }
+  if(op >= oend)
+    return NULL;
+  *op++ = (uint8_t)len;
+  return op;
+}
+
+/**
+ * @brief Put sequence: token, literals, offset, match length
+ *
+ * @param op        output pointer
+ * @param oend      output end
+ * @param lit       literals
+ * @param lit_len   literals count
+ * @param offset    match offset, 0 for the last sequence
+ * @param match_len match length (>= @ref LZ_MIN_MATCH)
+ * @return uint8_t* new output pointer, NULL if no space
+ */
+static uint8_t* _this_put_seq(uint8_t* op,const uint8_t* oend,const uint8_t* lit,size_t lit_len,size_t offset,size_t match_len)
+{
+  size_t  ml    = (offset != 0) ? match_len-LZ_MIN_MATCH : 0;
+  uint8_t token = (uint8_t)(((lit_len >= 15) ? 15 : lit_len)<<4)|(uint8_t)((ml >= 15) ? 15 : ml);
+
+  if(op >= oend)
+    return NULL;
+  *op++ = token;
+
+  if((lit_len >= 15)&&((op = _this_put_len(op,oend,lit_len-15)) == NULL))
+    return NULL;
+
+  if((size_t)(oend-op) < lit_len)
+    return NULL;
+  memcpy(op,lit,lit_len);
+  op += lit_len;
+
+  if(offset == 0)
+    return op;
+
+  if(oend-op < 2)
+    return NULL;
+  *op++ = (uint8_t)(offset);
+  *op++ = (uint8_t)(offset>>8);
+
+  if((ml >= 15)&&((op = _this_put_len(op,oend,ml-15)) == NULL))
+    return NULL;
+
+  return op;
+}
+
+/** @}*/
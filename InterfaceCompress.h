@@ -0,0 +1,85 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceCompress.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceCompress.c (LZ4-class frame compression)
+  * @version  V1.0.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_COMPRESS_H__
+#define __INTERFACE_COMPRESS_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Interface.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Compress Interface compression
+ * @brief    Optional compression stage before pack and after unpack
+ * @details  Every frame starts with one flag byte: @ref INTERFACE_COMPRESS_RAW or
+ *           @ref INTERFACE_COMPRESS_LZ. Block format is LZ4-like (token, literals,
+ *           16-bit offset, min match 4). Frames that do not shrink are sent raw.
+ *           Working memory is one hash table of 2^@ref INTERFACE_COMPRESS_HASH_BITS
+ *           16-bit entries plus two frame buffers.
+ * @{
+ */
+
+#ifndef INTERFACE_COMPRESS_HASH_BITS
+#define INTERFACE_COMPRESS_HASH_BITS  10u   /*!< Match finder hash table size (2^bits x 2 bytes)*/
+#endif
+
+#define INTERFACE_COMPRESS_RAW        0x00u /*!< Frame flag: payload as is*/
+#define INTERFACE_COMPRESS_LZ         0x01u /*!< Frame flag: payload compressed*/
+#define INTERFACE_COMPRESS_HEAD_SIZE  1u    /*!< Frame flag size*/
+
+/**
+ * @brief Compression statistic
+ *
+ */
+typedef struct
+{
+  uint32_t  TxFrames;     /*!< Frames passed to compressor*/
+  uint32_t  TxRaw;        /*!< Frames sent raw (incompressible)*/
+  uint32_t  TxIn;         /*!< Bytes before compression*/
+  uint32_t  TxOut;        /*!< Bytes after compression (with flag)*/
+  uint32_t  RxErrors;     /*!< Frames with broken flag or block*/
+}sInterfaceCompressStats_t;
+
+/**
+ * @defgroup Interface_Compress_public_func Interface compression public function
+ * @{
+ */
+  InterfaceCompress_t* InterfaceCompress_ctor(size_t MaxFrame);
+  void                 InterfaceCompress_dtor(InterfaceCompress_t* cthis);
+
+  size_t               InterfaceCompress_Pack(InterfaceCompress_t* cthis,uint8_t** dst,const uint8_t* src,size_t leng);
+  size_t               InterfaceCompress_Unpack(InterfaceCompress_t* cthis,uint8_t** dst,const uint8_t* src,size_t leng);
+
+  size_t               InterfaceCompress_Block(uint16_t* table,uint8_t* dst,size_t dst_max,const uint8_t* src,size_t leng);
+  size_t               InterfaceCompress_Unblock(uint8_t* dst,size_t dst_max,const uint8_t* src,size_t leng);
+
+  void                 InterfaceCompress_GetStats(InterfaceCompress_t* cthis,sInterfaceCompressStats_t* stats);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
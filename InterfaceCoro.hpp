@@ -0,0 +1,801 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceCoro.hpp
+  * @author  Wyrm
+  * @brief   C++20 coroutine layer over @ref InterfaceHandel_t (header only)
+  * @version  V1.0.1
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Create InterfaceExecutor with a clock (timeouts are in its ticks)
+  2. Wrap every interface (kInterfaceRxTx_process mode) by InterfaceCoLink,
+     pass a key field if replies carry the key of their request
+  3. Write conversations as InterfaceTask<> coroutines:
+       size_t n  = co_await link.read(buf);                  // next frame
+       bool   ok = co_await link.send(buf,len);              // waits for tx queue room
+       size_t r  = co_await link.request(cmd,len,buf,100);   // reply or 0 on timeout
+     buffers are as for Interface_readData / Interface_SendData (max frame
+     size, crc spare after payload)
+  4. exec.spawn(task()) for every conversation, then exec.run() (until all
+     spawned tasks end or stop()) or exec.run_once() from an existing loop
+  @note everything runs on the executor thread: it polls the links, the rx
+        callback routes frames to waiting coroutines and makes them ready,
+        run_once resumes them after the link polls of the same iteration
+        (never from inside Interface_poll), no locks and no thread per
+        conversation. Links must not be used from other threads
+  @note while a coroutine waits for rx, frames go straight from the interface
+        to it (cut-through). Frames which no waiter claims at that time
+        (wrong key, no reader) are dropped and counted by unclaimed()
+*/
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_CORO_HPP__
+#define __INTERFACE_CORO_HPP__
+
+#if !defined(__cplusplus) || (__cplusplus < 202002L)
+#error "InterfaceCoro.hpp needs C++20"
+#endif
+
+#include <coroutine>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "Interface.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Coro Interface C++20 coroutine layer
+ * @brief    co_await read/send/request on a single-threaded executor
+ * @{
+ */
+
+constexpr uint32_t InterfaceCoForever = UINT32_MAX;  /*!< No timeout*/
+
+class InterfaceExecutor;
+class InterfaceCoLink;
+
+struct InterfaceCoNode;
+
+/**
+ * @brief Intrusive list hook
+ *
+ */
+struct InterfaceCoHook
+{
+  InterfaceCoHook* Prev = nullptr;
+  InterfaceCoHook* Next = nullptr;
+  InterfaceCoNode* Self = nullptr;    /*!< node owning the hook*/
+};
+
+/**
+ * @brief Intrusive FIFO of nodes linked through the Hook member
+ *
+ */
+template<InterfaceCoHook InterfaceCoNode::*Hook>
+class InterfaceCoList
+{
+  public:
+    bool              empty() const { return Head == nullptr; }
+    InterfaceCoNode*  front() const { return Head ? Head->Self : nullptr; }
+    InterfaceCoNode*  back() const  { return Tail ? Tail->Self : nullptr; }
+
+    static InterfaceCoNode* next(InterfaceCoNode* node);
+    static InterfaceCoNode* prev(InterfaceCoNode* node);
+
+    void push_back(InterfaceCoNode* node)           { insert(nullptr,node); }
+    void insert(InterfaceCoNode* pos,InterfaceCoNode* node);
+    void remove(InterfaceCoNode* node);
+
+  private:
+    InterfaceCoHook* Head = nullptr;
+    InterfaceCoHook* Tail = nullptr;
+};
+
+/**
+ * @brief Suspended coroutine, waits in one wait list and optionally in the timer list
+ *
+ */
+struct InterfaceCoNode
+{
+  enum class eKind : uint8_t {Task,Read,Send,Request};
+
+  InterfaceCoHook         Wait;               /*!< wait list or ready list*/
+  InterfaceCoHook         Timer;              /*!< executor timer list*/
+  std::coroutine_handle<> Handle;
+  void*                   Owner    = nullptr; /*!< list it waits in, nullptr - none*/
+  uint32_t                Deadline = 0;
+  bool                    Timed    = false;
+  eKind                   Kind     = eKind::Task;
+};
+
+using InterfaceCoWaitList  = InterfaceCoList<&InterfaceCoNode::Wait>;
+using InterfaceCoTimerList = InterfaceCoList<&InterfaceCoNode::Timer>;
+
+template<InterfaceCoHook InterfaceCoNode::*Hook>
+inline InterfaceCoNode* InterfaceCoList<Hook>::next(InterfaceCoNode* node)
+{
+  InterfaceCoHook* h = (node->*Hook).Next;
+  return h ? h->Self : nullptr;
+}
+
+template<InterfaceCoHook InterfaceCoNode::*Hook>
+inline InterfaceCoNode* InterfaceCoList<Hook>::prev(InterfaceCoNode* node)
+{
+  InterfaceCoHook* h = (node->*Hook).Prev;
+  return h ? h->Self : nullptr;
+}
+
+/**
+ * @brief Insert node before pos, nullptr - at the end
+ *
+ */
+template<InterfaceCoHook InterfaceCoNode::*Hook>
+inline void InterfaceCoList<Hook>::insert(InterfaceCoNode* pos,InterfaceCoNode* node)
+{
+  InterfaceCoHook* h = &(node->*Hook);
+  InterfaceCoHook* p = pos ? &(pos->*Hook) : nullptr;
+
+  h->Self = node;
+  h->Next = p;
+  h->Prev = p ? p->Prev : Tail;
+  (h->Prev ? h->Prev->Next : Head) = h;
+  (p ? p->Prev : Tail) = h;
+}
+
+template<InterfaceCoHook InterfaceCoNode::*Hook>
+inline void InterfaceCoList<Hook>::remove(InterfaceCoNode* node)
+{
+  InterfaceCoHook* h = &(node->*Hook);
+
+  (h->Prev ? h->Prev->Next : Head) = h->Next;
+  (h->Next ? h->Next->Prev : Tail) = h->Prev;
+  h->Prev = h->Next = nullptr;
+}
+
+/**
+ * @brief Link operation (read, send, request) kept in the awaiting coroutine frame
+ *
+ */
+struct InterfaceCoOp : InterfaceCoNode
+{
+  InterfaceCoLink*  Link   = nullptr;
+  uint8_t*          Dst    = nullptr;   /*!< rx frame destination*/
+  void*             Data   = nullptr;   /*!< tx frame*/
+  size_t            Leng   = 0;         /*!< tx leng*/
+  size_t            Result = 0;         /*!< rx leng, or 1 - sent*/
+  uint32_t          Key    = 0;
+  bool              Keyed  = false;     /*!< reply is matched by key*/
+  bool              Sent   = false;     /*!< request phase*/
+};
+
+/**
+ * @brief Single-threaded executor: polls links, fires timeouts, resumes coroutines
+ *
+ */
+class InterfaceExecutor
+{
+  public:
+    explicit InterfaceExecutor(const sInterfaceClock_t& clock) : Clock(clock) {}
+    InterfaceExecutor(const InterfaceExecutor&) = delete;
+    InterfaceExecutor& operator=(const InterfaceExecutor&) = delete;
+
+    template<typename Task>
+    void      spawn(Task&& task);
+    bool      run_once();
+    void      run();
+    void      stop()                                { Stopped = true; }
+    void      set_idle(const sInterfaceNotify_t& idle) { Idle = idle; }
+    uint32_t  now() const                           { return Clock.func(Clock.parent); }
+    size_t    tasks() const                         { return Live; }
+
+    /** @brief Internal, used by links and tasks*/
+    void      _ready(InterfaceCoNode* node);
+    void      _arm(InterfaceCoNode* node,uint32_t timeout);
+    void      _disarm(InterfaceCoNode* node);
+    void      _task_done()                          { Live--; }
+    void      _attach(InterfaceCoLink* link);
+    void      _detach(InterfaceCoLink* link);
+
+  private:
+    bool      _expire();
+
+    sInterfaceClock_t     Clock;
+    sInterfaceNotify_t    Idle{};
+    InterfaceCoWaitList   Ready;
+    InterfaceCoTimerList  Timers;       /*!< sorted by deadline*/
+    InterfaceCoLink*      Links = nullptr;
+    size_t                Live  = 0;    /*!< spawned tasks not finished*/
+    bool                  Stopped = false;
+};
+
+/**
+ * @brief Task coroutine promise common part
+ *
+ */
+struct InterfaceTaskPromiseBase
+{
+  InterfaceCoNode         Node;                 /*!< ready list node of a spawned task*/
+  std::coroutine_handle<> Cont;                 /*!< awaiting coroutine*/
+  InterfaceExecutor*      Exec = nullptr;       /*!< set if spawned (detached)*/
+
+  struct Final
+  {
+    bool await_ready() noexcept { return false; }
+
+    template<typename P>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept
+    {
+      InterfaceTaskPromiseBase& p = h.promise();
+
+      if(p.Cont)
+        return p.Cont;
+      if(p.Exec != nullptr)
+      {
+        InterfaceExecutor* exec = p.Exec;
+        h.destroy();
+        exec->_task_done();
+      }
+      return std::noop_coroutine();
+    }
+
+    void await_resume() noexcept {}
+  };
+
+  std::suspend_always initial_suspend() noexcept { return {}; }
+  Final               final_suspend() noexcept   { return {}; }
+  void                unhandled_exception()      { std::terminate(); }
+};
+
+template<typename T>
+struct InterfaceTaskPromise : InterfaceTaskPromiseBase
+{
+  T Value{};
+  void return_value(T v) { Value = std::move(v); }
+};
+
+template<>
+struct InterfaceTaskPromise<void> : InterfaceTaskPromiseBase
+{
+  void return_void() {}
+};
+
+/**
+ * @brief Lazy coroutine task, started by co_await or @ref InterfaceExecutor::spawn
+ *
+ */
+template<typename T = void>
+class InterfaceTask
+{
+  public:
+    struct promise_type : InterfaceTaskPromise<T>
+    {
+      InterfaceTask get_return_object() { return InterfaceTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+    };
+
+    InterfaceTask(InterfaceTask&& other) noexcept : Handle(std::exchange(other.Handle,nullptr)) {}
+    InterfaceTask(const InterfaceTask&) = delete;
+    ~InterfaceTask() { if(Handle) Handle.destroy(); }
+
+    bool await_ready() const noexcept { return !Handle || Handle.done(); }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> cont) noexcept
+    {
+      Handle.promise().Cont = cont;
+      return Handle;
+    }
+
+    T await_resume()
+    {
+      if constexpr (!std::is_void_v<T>)
+        return std::move(Handle.promise().Value);
+    }
+
+    /** @brief Internal, hand over ownership to executor*/
+    std::coroutine_handle<promise_type> _release() { return std::exchange(Handle,nullptr); }
+
+  private:
+    explicit InterfaceTask(std::coroutine_handle<promise_type> h) : Handle(h) {}
+
+    std::coroutine_handle<promise_type> Handle;
+};
+
+/**
+ * @brief Awaitable of a link operation
+ *
+ */
+class InterfaceCoAwait
+{
+  public:
+    InterfaceCoAwait(InterfaceCoLink* link,InterfaceCoNode::eKind kind,uint32_t timeout,
+                     uint8_t* dst,void* data = nullptr,size_t leng = 0)
+      : Timeout(timeout)
+    {
+      Op.Link = link;
+      Op.Kind = kind;
+      Op.Dst  = dst;
+      Op.Data = data;
+      Op.Leng = leng;
+    }
+    InterfaceCoAwait(const InterfaceCoAwait&) = delete;
+
+    bool    await_ready();
+    void    await_suspend(std::coroutine_handle<> h);
+    size_t  await_resume() const { return Op.Result; }
+
+    InterfaceCoOp Op;
+    uint32_t      Timeout;
+};
+
+/**
+ * @brief Coroutine view of one @ref InterfaceHandel_t
+ *
+ */
+class InterfaceCoLink
+{
+  public:
+    InterfaceCoLink(InterfaceExecutor& exec,InterfaceHandel_t* iface,const sInterfaceKeyField_t* key = nullptr);
+    ~InterfaceCoLink();
+    InterfaceCoLink(const InterfaceCoLink&) = delete;
+    InterfaceCoLink& operator=(const InterfaceCoLink&) = delete;
+
+    /**
+     * @brief Wait for next frame
+     * @param dst     frame buffer of Interface_GetMaxDatalng() bytes
+     * @param timeout ticks of executor clock
+     * @return awaitable, co_await gives frame leng, 0 on timeout
+     */
+    InterfaceCoAwait read(uint8_t* dst,uint32_t timeout = InterfaceCoForever)
+    {
+      return InterfaceCoAwait(this,InterfaceCoNode::eKind::Read,timeout,dst);
+    }
+
+    /**
+     * @brief Send frame, wait while tx queue is full
+     * @param data    frame with crc spare as for Interface_SendData
+     * @param leng    frame leng
+     * @param timeout ticks of executor clock
+     * @return awaitable, co_await gives 1 if sent or queued, 0 on timeout or too long frame
+     */
+    InterfaceCoAwait send(void* data,size_t leng,uint32_t timeout = InterfaceCoForever)
+    {
+      return InterfaceCoAwait(this,InterfaceCoNode::eKind::Send,timeout,nullptr,data,leng);
+    }
+
+    /**
+     * @brief Send command and wait for its reply
+     * @details with a link key the reply is the first frame with the key of cmd,
+     *          else the first frame not taken by an older request
+     * @param cmd     command with crc spare as for Interface_SendData
+     * @param leng    command leng
+     * @param reply   reply buffer of Interface_GetMaxDatalng() bytes
+     * @param timeout ticks of executor clock, for send and reply together
+     * @return awaitable, co_await gives reply leng, 0 on timeout
+     */
+    InterfaceCoAwait request(void* cmd,size_t leng,uint8_t* reply,uint32_t timeout)
+    {
+      return InterfaceCoAwait(this,InterfaceCoNode::eKind::Request,timeout,reply,cmd,leng);
+    }
+
+    InterfaceHandel_t*  handle() const     { return Iface; }
+    InterfaceExecutor&  executor() const   { return Exec; }
+    uint32_t            unclaimed() const  { return Unclaimed; }
+
+    /** @brief Internal, used by awaitables and executor*/
+    bool                _try_read(InterfaceCoOp* op);
+    bool                _try_send(InterfaceCoOp* op);
+    void                _wait(InterfaceCoOp* op);
+    void                _cancel(InterfaceCoOp* op);
+    bool                _poll();
+
+    InterfaceCoLink*    NextLink = nullptr;  /*!< executor link list*/
+
+  private:
+    static void         _rx(void* parent,InterfaceHandel_t* iface,uint8_t* data,size_t len);
+    static void         _none(void* parent,InterfaceHandel_t* iface) { (void)parent; (void)iface; }
+    bool                _route(const uint8_t* data,size_t len);
+    void                _complete(InterfaceCoOp* op);
+    void                _cut();
+    bool                _rx_waiting() const { return !Readers.empty()||!Requests.empty(); }
+
+    InterfaceExecutor&          Exec;
+    InterfaceHandel_t*          Iface;
+    sInterfaceKeyField_t        Key{};
+    bool                        Keyed;
+    uint32_t                    Unclaimed = 0;
+    std::unique_ptr<uint8_t[]>  Backlog;    /*!< frame queued before a waiter came*/
+    InterfaceCoWaitList         Readers;
+    InterfaceCoWaitList         Requests;   /*!< sent, waiting for reply*/
+    InterfaceCoWaitList         Senders;    /*!< waiting for tx queue room, requests too*/
+};
+
+/* Executor ------------------------------------------------------------------*/
+
+/**
+ * @brief Start detached task, it runs on next @ref run_once
+ *
+ * @param task @ref InterfaceTask of void
+ */
+template<typename Task>
+inline void InterfaceExecutor::spawn(Task&& task)
+{
+  auto h = task._release();
+
+  if(!h)
+    return;
+
+  h.promise().Exec        = this;
+  h.promise().Node.Handle = h;
+  Live++;
+  _ready(&h.promise().Node);
+}
+
+/**
+ * @brief One executor iteration
+ *
+ * @return true   if a link was active or a coroutine ran
+ * @return false  idle
+ */
+inline bool InterfaceExecutor::run_once()
+{
+  bool active = false;
+
+  for(InterfaceCoLink* link = Links; link != nullptr; link = link->NextLink)
+    active |= link->_poll();
+
+  active |= _expire();
+
+  while(InterfaceCoNode* node = Ready.front())
+  {
+    Ready.remove(node);
+    node->Owner = nullptr;
+    node->Handle.resume();
+    active = true;
+  }
+
+  return active;
+}
+
+/**
+ * @brief Run until every spawned task ends or @ref stop, idle callback on idle iterations
+ *
+ */
+inline void InterfaceExecutor::run()
+{
+  Stopped = false;
+
+  while(!Stopped && (Live != 0))
+  {
+    if(!run_once() && (Idle.func != nullptr))
+      Idle.func(Idle.parent);
+  }
+}
+
+inline void InterfaceExecutor::_ready(InterfaceCoNode* node)
+{
+  node->Owner = &Ready;
+  Ready.push_back(node);
+}
+
+/**
+ * @brief Put node to timer list, kept sorted by deadline
+ *
+ */
+inline void InterfaceExecutor::_arm(InterfaceCoNode* node,uint32_t timeout)
+{
+  if(timeout == InterfaceCoForever)
+    return;
+
+  node->Deadline = now()+timeout;
+  node->Timed    = true;
+
+  /* equal timeouts keep their order, scan from the latest*/
+  InterfaceCoNode* pos = Timers.back();
+
+  while((pos != nullptr)&&((int32_t)(pos->Deadline-node->Deadline) > 0))
+    pos = InterfaceCoTimerList::prev(pos);
+
+  Timers.insert(pos ? InterfaceCoTimerList::next(pos) : Timers.front(),node);
+}
+
+inline void InterfaceExecutor::_disarm(InterfaceCoNode* node)
+{
+  if(!node->Timed)
+    return;
+
+  Timers.remove(node);
+  node->Timed = false;
+}
+
+/**
+ * @brief Complete timed out operations with result 0
+ *
+ */
+inline bool InterfaceExecutor::_expire()
+{
+  bool     fired = false;
+  uint32_t tick  = now();
+
+  while(InterfaceCoNode* node = Timers.front())
+  {
+    if((int32_t)(tick-node->Deadline) < 0)
+      break;
+
+    InterfaceCoOp* op = static_cast<InterfaceCoOp*>(node);
+
+    _disarm(node);
+    op->Link->_cancel(op);
+    op->Result = 0;
+    _ready(node);
+    fired = true;
+  }
+
+  return fired;
+}
+
+inline void InterfaceExecutor::_attach(InterfaceCoLink* link)
+{
+  link->NextLink = Links;
+  Links          = link;
+}
+
+inline void InterfaceExecutor::_detach(InterfaceCoLink* link)
+{
+  for(InterfaceCoLink** p = &Links; *p != nullptr; p = &(*p)->NextLink)
+  {
+    if(*p == link)
+    {
+      *p = link->NextLink;
+      return;
+    }
+  }
+}
+
+/* Awaitable -----------------------------------------------------------------*/
+
+inline bool InterfaceCoAwait::await_ready()
+{
+  switch(Op.Kind)
+  {
+    case InterfaceCoNode::eKind::Read:  return Op.Link->_try_read(&Op);
+    case InterfaceCoNode::eKind::Send:  return Op.Link->_try_send(&Op);
+    default:                            return false;
+  }
+}
+
+inline void InterfaceCoAwait::await_suspend(std::coroutine_handle<> h)
+{
+  Op.Handle = h;
+  Op.Link->executor()._arm(&Op,Timeout);
+  Op.Link->_wait(&Op);
+}
+
+/* Link ----------------------------------------------------------------------*/
+
+/**
+ * @brief Wrap interface, installs parent callbacks of the interface
+ *
+ * @param exec  executor polling the link
+ * @param iface pointer to @ref InterfaceHandel_t in process mode
+ * @param key   reply key field for @ref request, nullptr - replies in order
+ */
+inline InterfaceCoLink::InterfaceCoLink(InterfaceExecutor& exec,InterfaceHandel_t* iface,const sInterfaceKeyField_t* key)
+  : Exec(exec),Iface(iface),Keyed(key != nullptr),Backlog(new uint8_t[Interface_GetMaxDatalng(iface)])
+{
+  if(key != nullptr)
+    Key = *key;
+
+  sInterfaceIrqParentCB_t cb = {this,_rx,_none,_none};
+
+  Interface_SetCB(Iface,&cb);
+  Interface_SetCutThrough(Iface,false);
+  Exec._attach(this);
+}
+
+/**
+ * @brief Unwrap interface, coroutines still waiting on the link are never resumed
+ *
+ */
+inline InterfaceCoLink::~InterfaceCoLink()
+{
+  Interface_SetCutThrough(Iface,false);
+  Exec._detach(this);
+}
+
+/**
+ * @brief Take queued frame if no older reader waits
+ *
+ */
+inline bool InterfaceCoLink::_try_read(InterfaceCoOp* op)
+{
+  if(!Readers.empty())
+    return false;
+
+  op->Result = Interface_readData(Iface,op->Dst);
+  return op->Result != 0;
+}
+
+/**
+ * @brief Send at once if no older sender waits
+ *
+ */
+inline bool InterfaceCoLink::_try_send(InterfaceCoOp* op)
+{
+  if(op->Leng > Interface_GetMaxDatalng(Iface))
+  {
+    op->Result = 0;
+    return true;
+  }
+  if(!Senders.empty()||!Interface_SendData(Iface,op->Data,op->Leng))
+    return false;
+
+  op->Result = 1;
+  return true;
+}
+
+/**
+ * @brief Park suspended operation in its wait list
+ *
+ */
+inline void InterfaceCoLink::_wait(InterfaceCoOp* op)
+{
+  InterfaceCoWaitList* list = &Readers;
+
+  if(op->Kind == InterfaceCoNode::eKind::Send)
+    list = &Senders;
+  else if(op->Kind == InterfaceCoNode::eKind::Request)
+  {
+    op->Keyed = Keyed && Interface_GetKey(&Key,static_cast<const uint8_t*>(op->Data),op->Leng,&op->Key);
+    op->Sent  = Senders.empty()&&Interface_SendData(Iface,op->Data,op->Leng);
+    list     = op->Sent ? &Requests : &Senders;
+  }
+
+  op->Owner = list;
+  list->push_back(op);
+  _cut();
+}
+
+/**
+ * @brief Remove operation from its wait list (timeout)
+ *
+ */
+inline void InterfaceCoLink::_cancel(InterfaceCoOp* op)
+{
+  if(op->Owner != nullptr)
+    static_cast<InterfaceCoWaitList*>(op->Owner)->remove(op);
+  op->Owner = nullptr;
+  _cut();
+}
+
+/**
+ * @brief Poll interface, drain backlog to waiters, retry blocked senders
+ *
+ * @return true   if anything happened
+ * @return false  idle
+ */
+inline bool InterfaceCoLink::_poll()
+{
+  bool   active = Interface_poll(Iface);
+  size_t len;
+
+  /* frames queued while nobody waited, in order, before new ones*/
+  while(_rx_waiting()&&((len = Interface_readData(Iface,Backlog.get())) != 0))
+  {
+    _route(Backlog.get(),len);
+    active = true;
+  }
+
+  while(InterfaceCoNode* node = Senders.front())
+  {
+    InterfaceCoOp* op = static_cast<InterfaceCoOp*>(node);
+
+    if(!Interface_SendData(Iface,op->Data,op->Leng))
+      break;
+
+    Senders.remove(op);
+    if(op->Kind == InterfaceCoNode::eKind::Request)
+    {
+      op->Sent  = true;
+      op->Owner = &Requests;
+      Requests.push_back(op);
+    }
+    else
+    {
+      op->Owner  = nullptr;
+      op->Result = 1;
+      Exec._disarm(op);
+      Exec._ready(op);
+    }
+    active = true;
+  }
+
+  _cut();
+  return active;
+}
+
+/**
+ * @brief Interface rx callback, runs inside Interface_poll on executor thread
+ *
+ */
+inline void InterfaceCoLink::_rx(void* parent,InterfaceHandel_t* iface,uint8_t* data,size_t len)
+{
+  (void)iface;
+  static_cast<InterfaceCoLink*>(parent)->_route(data,len);
+}
+
+/**
+ * @brief Give frame to its waiter: keyed request, oldest unkeyed request, oldest reader
+ *
+ * @return true   if claimed
+ * @return false  dropped
+ */
+inline bool InterfaceCoLink::_route(const uint8_t* data,size_t len)
+{
+  InterfaceCoOp* op  = nullptr;
+  uint32_t       key = 0;
+  bool           has = Keyed && Interface_GetKey(&Key,data,len,&key);
+
+  for(InterfaceCoNode* n = Requests.front(); n != nullptr; n = InterfaceCoWaitList::next(n))
+  {
+    InterfaceCoOp* req = static_cast<InterfaceCoOp*>(n);
+
+    if(req->Keyed ? (has && (req->Key == key)) : true)
+    {
+      op = req;
+      break;
+    }
+  }
+
+  if(op == nullptr)
+    op = static_cast<InterfaceCoOp*>(Readers.front());
+
+  if(op == nullptr)
+  {
+    Unclaimed++;
+    return false;
+  }
+
+  std::memcpy(op->Dst,data,len);
+  op->Result = len;
+  _complete(op);
+  return true;
+}
+
+/**
+ * @brief Finish waiting operation, its coroutine goes to the executor ready list
+ * @note  not resumed here, called from the rx callback inside Interface_poll,
+ *        @ref InterfaceExecutor::run_once resumes it after the link polls
+ */
+inline void InterfaceCoLink::_complete(InterfaceCoOp* op)
+{
+  static_cast<InterfaceCoWaitList*>(op->Owner)->remove(op);
+  op->Owner = nullptr;
+  Exec._disarm(op);
+  Exec._ready(op);
+  _cut();
+}
+
+/**
+ * @brief Cut-through only while a coroutine waits for rx, else frames stay queued
+ *
+ */
+inline void InterfaceCoLink::_cut()
+{
+  Interface_SetCutThrough(Iface,_rx_waiting());
+}
+
+/** @}*/
+/** @}*/
+
+#endif
@@ -0,0 +1,245 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceDispatch.c
+ * @author   Wyrm
+ * @brief    Keyed rx dispatch table for @ref InterfaceHandel_t
+ * @version  V1.0.1
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Create the table with InterfaceDispatch_ctor(): key field, key space
+     (0 - unknown/32-bit) and max number of registered keys
+  2. Every module registers its own keys by InterfaceDispatch_Register()
+  3. Link the table by Interface_InstallDispatch(): frames with registered key go
+     straight to the handler in irq and process mode, others take the usual path
+  @note in kInterfaceRxTx_irq mode (un)register inside Rx critical section
+*/
+
+
+#include <string.h>
+
+#include "wheap.h"
+
+#include "InterfaceDispatch.h"
+#include "InterfaceIndex.h"
+
+
+/**
+ * @addtogroup Interface_Dispatch
+ * @{
+ */
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Dispatch table entry
+ *
+ */
+typedef struct
+{
+  uint32_t    Key;
+  ParentCbRx  Handler;  /*!< NULL - empty entry*/
+  void*       Ctx;
+}sDispatchEntry_t;
+
+/**
+ * @brief InterfaceDispatch Class
+ *
+ */
+struct InterfaceDispatch
+{
+  sInterfaceKeyField_t  Key;
+  bool                  Direct;   /*!< direct indexed table*/
+  size_t                Size;     /*!< direct: key space, hash: max entries*/
+  size_t                Used;     /*!< hash: entries are Table[0..Used)*/
+  sDispatchEntry_t*     Table;
+  sInterfaceIndex_t     Index;    /*!< hash: key -> entry*/
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Dispatch_Private_Functions Interface dispatch table private functions
+  * @{
+  */
+  static sDispatchEntry_t*  _this_find(InterfaceDispatch_t* cthis,uint32_t key);
+/** @}*/
+
+
+/**
+ * @brief InterfaceDispatch Class constructor
+ *
+ * @param key         pointer to @ref sInterfaceKeyField_t key position
+ * @param KeySpace    number of possible keys, 0 if unknown
+ * @param MaxEntries  max number of registered keys (hash mode), below 65535
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceDispatch_t* InterfaceDispatch_ctor(const sInterfaceKeyField_t* key,uint32_t KeySpace,size_t MaxEntries)
+{
+  if((key == NULL)||(key->Width == 0)||(key->Width > 4))
+    return NULL;
+
+  InterfaceDispatch_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceDispatch_t)) == NULL)
+    return NULL;
+
+  cthis->Key       = *key;
+  cthis->Used      = 0;
+  cthis->Direct    = (KeySpace != 0)&&(KeySpace <= INTERFACE_DISPATCH_DIRECT_MAX);
+  cthis->Size      = cthis->Direct ? KeySpace : MaxEntries;
+  cthis->Index.Ids = NULL;
+
+  if((cthis->Table = heap_malloc(cthis->Size*sizeof(sDispatchEntry_t))) == NULL)
+  {
+    heap_free(cthis);
+    return NULL;
+  }
+  memset(cthis->Table,0,cthis->Size*sizeof(sDispatchEntry_t));
+
+  if(!cthis->Direct && !InterfaceIndex_Init(&cthis->Index,MaxEntries,&cthis->Table[0].Key,sizeof(sDispatchEntry_t)))
+  {
+    InterfaceDispatch_dtor(cthis);
+    return NULL;
+  }
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceDispatch class destructor
+ *
+ * @param cthis pointer to @ref InterfaceDispatch_t
+ */
+void InterfaceDispatch_dtor(InterfaceDispatch_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  InterfaceIndex_Deinit(&cthis->Index);
+  heap_free(cthis->Table);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Register handler for key
+ *
+ * @param cthis   pointer to @ref InterfaceDispatch_t
+ * @param key     frame key
+ * @param handler handler function
+ * @param ctx     handler context (first handler argument)
+ * @return true   if registered (replaces previous handler of the key)
+ * @return false  key out of space or table full
+ */
+bool InterfaceDispatch_Register(InterfaceDispatch_t* cthis,uint32_t key,ParentCbRx handler,void* ctx)
+{
+  if((cthis == NULL)||(handler == NULL))
+    return false;
+
+  sDispatchEntry_t* entry = _this_find(cthis,key);
+
+  if(entry == NULL)
+  {
+    if(cthis->Direct || (cthis->Used == cthis->Size))
+      return false;
+
+    entry = &cthis->Table[cthis->Used];
+    entry->Key = key; /* index reads key of new entry*/
+    cthis->Index.Ids[InterfaceIndex_Find(&cthis->Index,key)] = (uint16_t)cthis->Used++;
+  }
+  else if(entry->Handler == NULL)
+    cthis->Used++;
+
+  entry->Key     = key;
+  entry->Ctx     = ctx;
+  entry->Handler = handler;
+
+  return true;
+}
+
+/**
+ * @brief Remove handler of key
+ *
+ * @param cthis pointer to @ref InterfaceDispatch_t
+ * @param key   frame key
+ * @return true   if removed
+ * @return false  key was not registered
+ */
+bool InterfaceDispatch_Unregister(InterfaceDispatch_t* cthis,uint32_t key)
+{
+  if(cthis == NULL)
+    return false;
+
+  sDispatchEntry_t* entry = _this_find(cthis,key);
+
+  if((entry == NULL)||(entry->Handler == NULL))
+    return false;
+
+  entry->Handler = NULL;
+  cthis->Used--;
+
+  if(cthis->Direct)
+    return true;
+
+  InterfaceIndex_Erase(&cthis->Index,InterfaceIndex_Find(&cthis->Index,key));
+
+  /* keep entries dense, last one fills the gap*/
+  sDispatchEntry_t* last = &cthis->Table[cthis->Used];
+
+  if(entry != last)
+  {
+    *entry = *last;
+    last->Handler = NULL;
+    cthis->Index.Ids[InterfaceIndex_Find(&cthis->Index,entry->Key)] = (uint16_t)(entry-cthis->Table);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Route frame to the handler of its key
+ *
+ * @param cthis pointer to @ref InterfaceDispatch_t
+ * @param iface pointer to @ref InterfaceHandel_t passed to handler
+ * @param data  frame
+ * @param leng  frame size
+ * @return true   if handler called
+ * @return false  no handler, frame should take the usual path
+ */
+bool InterfaceDispatch_Route(InterfaceDispatch_t* cthis,InterfaceHandel_t* iface,uint8_t* data,size_t leng)
+{
+  uint32_t key = 0;
+
+  if(!Interface_GetKey(&cthis->Key,data,leng,&key))
+    return false;
+
+  sDispatchEntry_t* entry = _this_find(cthis,key);
+
+  if((entry == NULL)||(entry->Handler == NULL))
+    return false;
+
+  entry->Handler(entry->Ctx,iface,data,leng);
+  return true;
+}
+
+/**
+ * @brief Find entry of key
+ *
+ * @param cthis pointer to @ref InterfaceDispatch_t
+ * @param key   frame key
+ * @return sDispatchEntry_t* direct: slot of key (may be empty), hash: entry or NULL
+ */
+static sDispatchEntry_t* _this_find(InterfaceDispatch_t* cthis,uint32_t key)
+{
+  if(cthis->Direct)
+    return (key < cthis->Size) ? &cthis->Table[key] : NULL;
+
+  size_t i = InterfaceIndex_Find(&cthis->Index,key);
+
+  return (cthis->Index.Ids[i] != INTERFACE_INDEX_NONE) ? &cthis->Table[cthis->Index.Ids[i]] : NULL;
+}
+
+/** @}*/
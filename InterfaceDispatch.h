@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceDispatch.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceDispatch.c (keyed rx dispatch table)
+  * @version  V1.0.1
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_DISPATCH_H__
+#define __INTERFACE_DISPATCH_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Interface.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Dispatch Interface dispatch table
+ * @brief    Route received frames to per key handlers
+ * @details  Key space up to @ref INTERFACE_DISPATCH_DIRECT_MAX is a direct indexed array,
+ *           bigger key spaces use open addressing hash with linear probing
+ * @{
+ */
+
+#ifndef INTERFACE_DISPATCH_DIRECT_MAX
+#define INTERFACE_DISPATCH_DIRECT_MAX   256u  /*!< Max key space for direct indexed table*/
+#endif
+
+/**
+ * @defgroup Interface_Dispatch_public_func Interface dispatch table public function
+ * @{
+ */
+  InterfaceDispatch_t* InterfaceDispatch_ctor(const sInterfaceKeyField_t* key,uint32_t KeySpace,size_t MaxEntries);
+  void                 InterfaceDispatch_dtor(InterfaceDispatch_t* cthis);
+
+  bool                 InterfaceDispatch_Register(InterfaceDispatch_t* cthis,uint32_t key,ParentCbRx handler,void* ctx);
+  bool                 InterfaceDispatch_Unregister(InterfaceDispatch_t* cthis,uint32_t key);
+
+  bool                 InterfaceDispatch_Route(InterfaceDispatch_t* cthis,InterfaceHandel_t* iface,uint8_t* data,size_t leng);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
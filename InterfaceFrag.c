@@ -0,0 +1,499 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceFrag.c
+ * @author   Wyrm
+ * @brief    Fragmentation and reassembly of messages bigger than one @ref InterfaceHandel_t frame
+ * @version  V1.0.1
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Create the class with InterfaceFrag_ctor() and link it by Interface_InstallFrag()
+  2. InterfaceFrag_Send() starts the transfer, fragments are streamed into the
+     tx path while it accepts them, the rest is pumped by InterfaceFrag_process()
+     (Interface_process() does it in process mode).
+     Message buffer must stay valid until InterfaceFrag_IsTxIdle()
+  3. Reassembled messages are delivered to RxCb or through the usual Interface path.
+     Peers must use the same or bigger FragPayload
+*/
+
+
+#include <string.h>
+
+#include "wheap.h"
+
+#include "InterfaceFrag.h"
+#include "InterfaceArq.h"
+
+
+/**
+ * @addtogroup Interface_Frag
+ * @{
+ */
+
+/* Private macro -------------------------------------------------------------*/
+#define FRAG_CRC_SPARE  4u    /*!< Interface_SendData appends crc right after payload*/
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Reassembly context
+ *
+ */
+typedef struct
+{
+  uint8_t*  Buff;       /*!< message buffer, MaxMessage*/
+  uint8_t*  Bitmap;     /*!< received fragments*/
+  size_t    Len;        /*!< message leng, known after last fragment*/
+  uint32_t  LastTick;   /*!< last fragment tick*/
+  uint16_t  MsgId;
+  uint16_t  Count;
+  uint16_t  Chunk;
+  uint16_t  Got;
+  bool      Used;
+}sFragCtx_t;
+
+/**
+ * @brief InterfaceFrag Class
+ *
+ */
+struct InterfaceFrag
+{
+  InterfaceHandel_t*  Iface;
+  sInterfaceFragCfg_t Cfg;
+  size_t              MaxFrags;   /*!< max fragments per message*/
+
+  const uint8_t*      TxData;     /*!< message in progress*/
+  size_t              TxLen;
+  uint16_t            TxId;
+  uint16_t            TxIdx;      /*!< next fragment to send*/
+  uint16_t            TxCount;
+  bool                TxBusy;
+  bool                TxStaged;   /*!< TxBuff holds fragment TxIdx*/
+  size_t              TxStagedLen;
+  uint8_t*            TxBuff;     /*!< header + payload + crc spare*/
+
+  sFragCtx_t*         Pool;
+  uint8_t*            Ready;      /*!< complete message for pop*/
+  size_t              ReadyLen;
+
+  sInterfaceFragStats_t Stats;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Frag_Private_Functions Interface fragmentation private functions
+  * @{
+  */
+  static uint32_t     _this_now(const InterfaceFrag_t* cthis);
+  static bool         _this_lower_send(InterfaceFrag_t* cthis,uint8_t* data,size_t leng);
+  static void         _this_tx_pump(InterfaceFrag_t* cthis);
+  static void         _this_expire(InterfaceFrag_t* cthis,uint32_t now);
+  static sFragCtx_t*  _this_ctx_get(InterfaceFrag_t* cthis,uint16_t id,uint16_t count,uint16_t chunk,uint32_t now);
+/** @}*/
+
+
+/**
+ * @brief InterfaceFrag Class constructor
+ *
+ * @param iface pointer to @ref InterfaceHandel_t transport
+ * @param cfg   pointer to @ref sInterfaceFragCfg_t configuration
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceFrag_t* InterfaceFrag_ctor(InterfaceHandel_t* iface,const sInterfaceFragCfg_t* cfg)
+{
+  if((iface == NULL)||(cfg == NULL)||(cfg->Clock.func == NULL))
+    return NULL;
+  if((cfg->MaxMessage == 0)||(cfg->PoolSize == 0))
+    return NULL;
+
+  InterfaceFrag_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceFrag_t)) == NULL)
+    return NULL;
+  memset(cthis,0,sizeof(InterfaceFrag_t));
+
+  cthis->Iface = iface;
+  cthis->Cfg   = *cfg;
+
+  if(cthis->Cfg.FragPayload == 0)
+  {
+    size_t head = INTERFACE_FRAG_HEAD_SIZE+FRAG_CRC_SPARE+((cfg->Arq != NULL) ? INTERFACE_ARQ_HEAD_SIZE : 0);
+    size_t max  = Interface_GetMaxDatalng(iface);
+
+    cthis->Cfg.FragPayload = (max > head) ? max-head : 0;
+  }
+  if((cthis->Cfg.FragPayload == 0)||(cthis->Cfg.FragPayload > UINT16_MAX))
+  {
+    heap_free(cthis);
+    return NULL;
+  }
+
+  cthis->MaxFrags = (cfg->MaxMessage+cthis->Cfg.FragPayload-1)/cthis->Cfg.FragPayload;
+  if(cthis->MaxFrags > UINT16_MAX)
+  {
+    heap_free(cthis);
+    return NULL;
+  }
+
+  cthis->TxBuff = heap_malloc(INTERFACE_FRAG_HEAD_SIZE+cthis->Cfg.FragPayload+FRAG_CRC_SPARE);
+  cthis->Pool   = heap_malloc(cfg->PoolSize*sizeof(sFragCtx_t));
+  if((cthis->TxBuff == NULL)||(cthis->Pool == NULL))
+  {
+    InterfaceFrag_dtor(cthis);
+    return NULL;
+  }
+  memset(cthis->Pool,0,cfg->PoolSize*sizeof(sFragCtx_t));
+
+  for(size_t i = 0;i<cfg->PoolSize;i++)
+  {
+    cthis->Pool[i].Buff   = heap_malloc(cfg->MaxMessage);
+    cthis->Pool[i].Bitmap = heap_malloc((cthis->MaxFrags+7)/8);
+    if((cthis->Pool[i].Buff == NULL)||(cthis->Pool[i].Bitmap == NULL))
+    {
+      InterfaceFrag_dtor(cthis);
+      return NULL;
+    }
+  }
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceFrag class destructor
+ *
+ * @param cthis pointer to @ref InterfaceFrag_t
+ */
+void InterfaceFrag_dtor(InterfaceFrag_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  if(cthis->Pool)
+  {
+    for(size_t i = 0;i<cthis->Cfg.PoolSize;i++)
+    {
+      heap_free(cthis->Pool[i].Buff);
+      heap_free(cthis->Pool[i].Bitmap);
+    }
+  }
+  heap_free(cthis->Pool);
+  heap_free(cthis->TxBuff);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Start message transfer
+ * @note  data is not copied, buffer must stay valid until @ref InterfaceFrag_IsTxIdle
+ * @param cthis pointer to @ref InterfaceFrag_t
+ * @param data  pointer to message
+ * @param leng  message size (<= MaxMessage)
+ * @return true   if transfer started
+ * @return false  previous transfer in progress or message too big
+ */
+bool InterfaceFrag_Send(InterfaceFrag_t* cthis,const void* data,size_t leng)
+{
+  if((cthis == NULL)||(data == NULL)||(leng == 0)||(leng > cthis->Cfg.MaxMessage))
+    return false;
+  if(cthis->TxBusy)
+    return false;
+
+  cthis->TxData   = data;
+  cthis->TxLen    = leng;
+  cthis->TxIdx    = 0;
+  cthis->TxCount  = (uint16_t)((leng+cthis->Cfg.FragPayload-1)/cthis->Cfg.FragPayload);
+  cthis->TxId++;
+  cthis->TxStaged = false;
+  cthis->TxBusy   = true;
+
+  _this_tx_pump(cthis);
+
+  return true;
+}
+
+/**
+ * @brief Check is message transfer finished
+ *
+ * @param cthis pointer to @ref InterfaceFrag_t
+ * @return true   if every fragment passed to tx path
+ * @return false  else
+ */
+bool InterfaceFrag_IsTxIdle(InterfaceFrag_t* cthis)
+{
+  return !cthis->TxBusy;
+}
+
+/**
+ * @brief Input fragment received by interface
+ *
+ * @param cthis pointer to @ref InterfaceFrag_t
+ * @param src   pointer to fragment
+ * @param leng  fragment size
+ * @return true   if message complete, call @ref InterfaceFrag_Pop
+ * @return false  else (or message passed to RxCb)
+ */
+bool InterfaceFrag_Input(InterfaceFrag_t* cthis,uint8_t* src,size_t leng)
+{
+  if((cthis == NULL)||(leng <= INTERFACE_FRAG_HEAD_SIZE))
+  {
+    if(cthis)
+      cthis->Stats.RxInvalid++;
+    return false;
+  }
+
+  uint16_t id    = (uint16_t)(src[0]|(src[1]<<8));
+  uint16_t idx   = (uint16_t)(src[2]|(src[3]<<8));
+  uint16_t count = (uint16_t)(src[4]|(src[5]<<8));
+  uint16_t chunk = (uint16_t)(src[6]|(src[7]<<8));
+  size_t   pay   = leng-INTERFACE_FRAG_HEAD_SIZE;
+  size_t   off   = (size_t)idx*chunk;
+
+  if(  (count == 0)||(idx >= count)||(count > cthis->MaxFrags)
+     ||(pay > chunk)||((idx+1u < count)&&(pay != chunk))
+     ||(off+pay > cthis->Cfg.MaxMessage))
+  {
+    cthis->Stats.RxInvalid++;
+    return false;
+  }
+
+  uint32_t now = _this_now(cthis);
+
+  _this_expire(cthis,now);
+  cthis->Stats.RxFragments++;
+
+  if(count == 1)
+  {
+    cthis->Ready    = src+INTERFACE_FRAG_HEAD_SIZE; /* single fragment, no copy*/
+    cthis->ReadyLen = pay;
+  }
+  else
+  {
+    sFragCtx_t* ctx = _this_ctx_get(cthis,id,count,chunk,now);
+
+    if(ctx->Bitmap[idx>>3] & (1u<<(idx&7)))
+    {
+      cthis->Stats.RxFragments--;
+      cthis->Stats.RxDuplicates++;
+      return false;
+    }
+    ctx->Bitmap[idx>>3] |= (uint8_t)(1u<<(idx&7));
+    memcpy(ctx->Buff+off,src+INTERFACE_FRAG_HEAD_SIZE,pay);
+    ctx->Got++;
+    ctx->LastTick = now;
+    if(idx+1u == count)
+      ctx->Len = off+pay;
+
+    if(ctx->Got != ctx->Count)
+      return false;
+
+    ctx->Used = false; /* buffer stays intact until next input*/
+    cthis->Ready    = ctx->Buff;
+    cthis->ReadyLen = ctx->Len;
+  }
+
+  cthis->Stats.RxMessages++;
+
+  if(cthis->Cfg.RxCb == NULL)
+    return true;
+
+  cthis->Cfg.RxCb(cthis->Cfg.parent,cthis->Iface,cthis->Ready,cthis->ReadyLen);
+  cthis->ReadyLen = 0;
+  return false;
+}
+
+/**
+ * @brief Pop complete message
+ * @note  returned pointer is valid until next @ref InterfaceFrag_Input call
+ * @param cthis pointer to @ref InterfaceFrag_t
+ * @param dst   pointer to data pointer
+ * @return size_t message size, 0 if no complete message
+ */
+size_t InterfaceFrag_Pop(InterfaceFrag_t* cthis,uint8_t** dst)
+{
+  size_t leng = cthis->ReadyLen;
+
+  cthis->ReadyLen = 0;
+  (*dst) = cthis->Ready;
+
+  return leng;
+}
+
+/**
+ * @brief Check complete messages go to RxCb, not through Interface
+ *
+ * @param cthis pointer to @ref InterfaceFrag_t
+ * @return true   if RxCb is set
+ * @return false  messages are taken by @ref InterfaceFrag_Pop
+ */
+bool InterfaceFrag_IsRxDirect(InterfaceFrag_t* cthis) {return cthis->Cfg.RxCb != NULL;}
+
+/**
+ * @brief Fragmentation none blocking process: pump fragments, drop stale messages
+ *
+ * @param cthis pointer to @ref InterfaceFrag_t
+ */
+void InterfaceFrag_process(InterfaceFrag_t* cthis)
+{
+  _this_tx_pump(cthis);
+  _this_expire(cthis,_this_now(cthis));
+}
+
+/**
+ * @brief Get fragmentation statistic
+ *
+ * @param cthis pointer to @ref InterfaceFrag_t
+ * @param stats pointer to output @ref sInterfaceFragStats_t
+ */
+void InterfaceFrag_GetStats(InterfaceFrag_t* cthis,sInterfaceFragStats_t* stats)
+{
+  *stats = cthis->Stats;
+}
+
+/**
+ * @brief Get clock tick
+ *
+ * @param cthis pointer to @ref InterfaceFrag_t
+ * @return uint32_t current tick
+ */
+static uint32_t _this_now(const InterfaceFrag_t* cthis)
+{
+  return cthis->Cfg.Clock.func(cthis->Cfg.Clock.parent);
+}
+
+/**
+ * @brief Pass fragment to reliability layer or interface
+ *
+ * @param cthis pointer to @ref InterfaceFrag_t
+ * @param data  pointer to fragment (with crc spare)
+ * @param leng  fragment size
+ * @return true   if accepted
+ * @return false  tx path busy
+ */
+static bool _this_lower_send(InterfaceFrag_t* cthis,uint8_t* data,size_t leng)
+{
+  if(cthis->Cfg.Arq != NULL)
+    return InterfaceArq_Send(cthis->Cfg.Arq,data,leng);
+  else
+    return Interface_SendData(cthis->Iface,data,leng);
+}
+
+/**
+ * @brief Stream fragments while tx path accepts them
+ *
+ * @param cthis pointer to @ref InterfaceFrag_t
+ */
+static void _this_tx_pump(InterfaceFrag_t* cthis)
+{
+  while(cthis->TxBusy)
+  {
+    if(!cthis->TxStaged)
+    {
+      size_t off = (size_t)cthis->TxIdx*cthis->Cfg.FragPayload;
+      size_t pay = cthis->TxLen-off;
+
+      if(pay > cthis->Cfg.FragPayload)
+        pay = cthis->Cfg.FragPayload;
+
+      cthis->TxBuff[0] = (uint8_t)(cthis->TxId);
+      cthis->TxBuff[1] = (uint8_t)(cthis->TxId>>8);
+      cthis->TxBuff[2] = (uint8_t)(cthis->TxIdx);
+      cthis->TxBuff[3] = (uint8_t)(cthis->TxIdx>>8);
+      cthis->TxBuff[4] = (uint8_t)(cthis->TxCount);
+      cthis->TxBuff[5] = (uint8_t)(cthis->TxCount>>8);
+      cthis->TxBuff[6] = (uint8_t)(cthis->Cfg.FragPayload);
+      cthis->TxBuff[7] = (uint8_t)(cthis->Cfg.FragPayload>>8);
+      memcpy(cthis->TxBuff+INTERFACE_FRAG_HEAD_SIZE,cthis->TxData+off,pay);
+
+      cthis->TxStagedLen = INTERFACE_FRAG_HEAD_SIZE+pay;
+      cthis->TxStaged    = true;
+    }
+
+    if(!_this_lower_send(cthis,cthis->TxBuff,cthis->TxStagedLen))
+      return; /* tx path full, process() continues*/
+
+    cthis->TxStaged = false;
+    cthis->Stats.TxFragments++;
+
+    if(++cthis->TxIdx == cthis->TxCount)
+    {
+      cthis->TxBusy = false;
+      cthis->Stats.TxMessages++;
+    }
+  }
+}
+
+/**
+ * @brief Drop incomplete messages older than timeout
+ *
+ * @param cthis pointer to @ref InterfaceFrag_t
+ * @param now   current tick
+ */
+static void _this_expire(InterfaceFrag_t* cthis,uint32_t now)
+{
+  if(cthis->Cfg.Timeout == 0)
+    return;
+
+  for(size_t i = 0;i<cthis->Cfg.PoolSize;i++)
+  {
+    if(cthis->Pool[i].Used && ((uint32_t)(now-cthis->Pool[i].LastTick) > cthis->Cfg.Timeout))
+    {
+      cthis->Pool[i].Used = false;
+      cthis->Stats.RxTimeouts++;
+    }
+  }
+}
+
+/**
+ * @brief Find reassembly context of the message or take a new one
+ * @details if pool is full the oldest incomplete message is dropped
+ * @param cthis pointer to @ref InterfaceFrag_t
+ * @param id    message id
+ * @param count fragment count
+ * @param chunk fragment payload size
+ * @param now   current tick
+ * @return sFragCtx_t* reassembly context
+ */
+static sFragCtx_t* _this_ctx_get(InterfaceFrag_t* cthis,uint16_t id,uint16_t count,uint16_t chunk,uint32_t now)
+{
+  sFragCtx_t* free_ctx = NULL;
+  sFragCtx_t* old_ctx  = &cthis->Pool[0];
+
+  for(size_t i = 0;i<cthis->Cfg.PoolSize;i++)
+  {
+    sFragCtx_t* ctx = &cthis->Pool[i];
+
+    if(!ctx->Used)
+    {
+      if(free_ctx == NULL)
+        free_ctx = ctx;
+      continue;
+    }
+    if((ctx->MsgId == id)&&(ctx->Count == count)&&(ctx->Chunk == chunk))
+      return ctx;
+    if((uint32_t)(now-ctx->LastTick) > (uint32_t)(now-old_ctx->LastTick) || !old_ctx->Used)
+      old_ctx = ctx;
+  }
+
+  if(free_ctx == NULL)
+  {
+    free_ctx = old_ctx;
+    if(free_ctx->Used)
+      cthis->Stats.RxEvicted++;
+  }
+
+  free_ctx->Used     = true;
+  free_ctx->MsgId    = id;
+  free_ctx->Count    = count;
+  free_ctx->Chunk    = chunk;
+  free_ctx->Got      = 0;
+  free_ctx->Len      = 0;
+  free_ctx->LastTick = now;
+  memset(free_ctx->Bitmap,0,(count+7u)/8u);
+
+  return free_ctx;
+}
+
+/** @}*/
@@ -0,0 +1,99 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceFrag.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceFrag.c (fragmentation and reassembly)
+  * @version  V1.0.1
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_FRAG_H__
+#define __INTERFACE_FRAG_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Interface.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Frag Interface fragmentation
+ * @brief    Send messages bigger than one frame
+ * @details  Every fragment carries @ref INTERFACE_FRAG_HEAD_SIZE bytes of header:
+ *           message id, fragment index, fragment count and fragment payload size.
+ *           Fragments are streamed back-to-back into the tx path, the receiver
+ *           collects them in a bounded pool of reassembly contexts.
+ * @{
+ */
+
+#define INTERFACE_FRAG_HEAD_SIZE  8u  /*!< Fragment header size in bytes*/
+
+/**
+ * @brief Fragmentation configuration
+ *
+ */
+typedef struct
+{
+  size_t    MaxMessage;   /*!< Max message size, reassembly buffer size*/
+  size_t    FragPayload;  /*!< Payload per fragment, 0 - from @ref Interface_GetMaxDatalng*/
+  size_t    PoolSize;     /*!< Number of messages reassembled at the same time*/
+  uint32_t  Timeout;      /*!< Incomplete message lifetime in clock ticks*/
+  sInterfaceClock_t Clock;/*!< Monotonic clock*/
+  InterfaceArq_t*   Arq;  /*!< Send fragments through reliability layer, NULL - directly*/
+  void*       parent;     /*!< Parent for RxCb*/
+  ParentCbRx  RxCb;       /*!< Complete message callback, NULL - deliver through Interface*/
+}sInterfaceFragCfg_t;
+
+/**
+ * @brief Fragmentation statistic
+ *
+ */
+typedef struct
+{
+  uint32_t  TxMessages;   /*!< Messages completely sent*/
+  uint32_t  TxFragments;  /*!< Fragments sent*/
+  uint32_t  RxMessages;   /*!< Messages reassembled*/
+  uint32_t  RxFragments;  /*!< Fragments accepted*/
+  uint32_t  RxDuplicates; /*!< Fragments received twice*/
+  uint32_t  RxInvalid;    /*!< Fragments with broken header*/
+  uint32_t  RxTimeouts;   /*!< Incomplete messages dropped by timeout*/
+  uint32_t  RxEvicted;    /*!< Incomplete messages dropped for new one*/
+}sInterfaceFragStats_t;
+
+/**
+ * @defgroup Interface_Frag_public_func Interface fragmentation public function
+ * @{
+ */
+  InterfaceFrag_t*    InterfaceFrag_ctor(InterfaceHandel_t* iface,const sInterfaceFragCfg_t* cfg);
+  void                InterfaceFrag_dtor(InterfaceFrag_t* cthis);
+
+  bool                InterfaceFrag_Send(InterfaceFrag_t* cthis,const void* data,size_t leng);
+  bool                InterfaceFrag_IsTxIdle(InterfaceFrag_t* cthis);
+
+  bool                InterfaceFrag_Input(InterfaceFrag_t* cthis,uint8_t* src,size_t leng);
+  size_t              InterfaceFrag_Pop(InterfaceFrag_t* cthis,uint8_t** dst);
+  bool                InterfaceFrag_IsRxDirect(InterfaceFrag_t* cthis);
+
+  void                InterfaceFrag_process(InterfaceFrag_t* cthis);
+  void                InterfaceFrag_GetStats(InterfaceFrag_t* cthis,sInterfaceFragStats_t* stats);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,188 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceIndex.c
+ * @author   Wyrm
+ * @brief    Key to entry id hash index for dispatch table and keyed queue
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Keep entries in own array with uint32_t key at the same place in every entry
+  2. InterfaceIndex_Init(&idx,max,&entries[0].Key,sizeof(entries[0]))
+  3. pos = InterfaceIndex_Find(&idx,key):
+     - idx.Ids[pos] != INTERFACE_INDEX_NONE - id of entry with key
+     - else                                 - set idx.Ids[pos] = id to add it
+  4. InterfaceIndex_Erase(&idx,pos) removes position got from Find
+  @note entry must keep its key while it is in index, re-add it after a move
+*/
+
+
+#include <string.h>
+
+#include "wheap.h"
+
+#include "InterfaceIndex.h"
+
+
+/**
+ * @addtogroup Interface_Index
+ * @{
+ */
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Index_Private_Functions Interface key index private functions
+  * @{
+  */
+  static inline size_t    _this_home(const sInterfaceIndex_t* idx,uint32_t key);
+  static inline uint32_t  _this_key(const sInterfaceIndex_t* idx,size_t pos);
+/** @}*/
+
+
+/**
+ * @brief Allocate index for up to MaxEntries entries
+ *
+ * @param idx         pointer to @ref sInterfaceIndex_t
+ * @param MaxEntries  max number of entries, below @ref INTERFACE_INDEX_NONE
+ * @param keys        key of entry 0
+ * @param stride      distance between keys of next entries
+ * @return true   if allocated
+ * @return false  no memory or too many entries
+ */
+bool InterfaceIndex_Init(sInterfaceIndex_t* idx,size_t MaxEntries,const uint32_t* keys,size_t stride)
+{
+  if((MaxEntries == 0)||(MaxEntries >= INTERFACE_INDEX_NONE))
+    return false;
+
+  idx->Bits = 1;
+  while(((size_t)1 << idx->Bits) < 2*MaxEntries) /* load factor <= 0.5*/
+    idx->Bits++;
+
+  idx->Keys   = (const uint8_t*)keys;
+  idx->Stride = stride;
+
+  if((idx->Ids = heap_malloc(((size_t)1 << idx->Bits)*sizeof(uint16_t))) == NULL)
+    return false;
+
+  InterfaceIndex_Clear(idx);
+
+  return true;
+}
+
+/**
+ * @brief Free index memory
+ *
+ * @param idx pointer to @ref sInterfaceIndex_t
+ */
+void InterfaceIndex_Deinit(sInterfaceIndex_t* idx)
+{
+  heap_free(idx->Ids);
+  idx->Ids = NULL;
+}
+
+/**
+ * @brief Remove every entry
+ *
+ * @param idx pointer to @ref sInterfaceIndex_t
+ */
+void InterfaceIndex_Clear(sInterfaceIndex_t* idx)
+{
+  memset(idx->Ids,0xFF,((size_t)1 << idx->Bits)*sizeof(uint16_t));
+}
+
+/**
+ * @brief Find position of key
+ *
+ * @param idx pointer to @ref sInterfaceIndex_t
+ * @param key entry key
+ * @return size_t position of key, or empty position where key would be
+ */
+size_t InterfaceIndex_Find(const sInterfaceIndex_t* idx,uint32_t key)
+{
+  size_t mask = ((size_t)1 << idx->Bits)-1;
+  size_t i    = _this_home(idx,key);
+
+  while((idx->Ids[i] != INTERFACE_INDEX_NONE)&&(_this_key(idx,i) != key))
+    i = (i+1)&mask;
+
+  return i;
+}
+
+/**
+ * @brief Remove entry at position
+ *
+ * @param idx pointer to @ref sInterfaceIndex_t
+ * @param pos position from @ref InterfaceIndex_Find
+ */
+void InterfaceIndex_Erase(sInterfaceIndex_t* idx,size_t pos)
+{
+  size_t mask = ((size_t)1 << idx->Bits)-1;
+  size_t hole = pos;
+  size_t i    = pos;
+
+  idx->Ids[hole] = INTERFACE_INDEX_NONE;
+
+  /* backward shift deletion keeps probe chains without tombstones*/
+  for(;;)
+  {
+    i = (i+1)&mask;
+    if(idx->Ids[i] == INTERFACE_INDEX_NONE)
+      break;
+
+    size_t home = _this_home(idx,_this_key(idx,i));
+
+    /* move entry if its home is not in (hole,i] cyclically*/
+    if(((i-home)&mask) >= ((i-hole)&mask))
+    {
+      idx->Ids[hole] = idx->Ids[i];
+      idx->Ids[i]    = INTERFACE_INDEX_NONE;
+      hole = i;
+    }
+  }
+}
+
+/**
+ * @brief Get index memory
+ *
+ * @param idx pointer to @ref sInterfaceIndex_t
+ * @return size_t bytes allocated by index
+ */
+size_t InterfaceIndex_GetFootprint(const sInterfaceIndex_t* idx)
+{
+  return ((size_t)1 << idx->Bits)*sizeof(uint16_t);
+}
+
+/**
+ * @brief Home position of key (Knuth multiplicative, high bits)
+ * @note  low bits of the product only depend on low bits of the key,
+ *        sequential or aligned keys would cluster there
+ * @param idx pointer to @ref sInterfaceIndex_t
+ * @param key entry key
+ * @return size_t home position
+ */
+static inline size_t _this_home(const sInterfaceIndex_t* idx,uint32_t key)
+{
+  return (size_t)((key*2654435761u)>>(32u-idx->Bits));
+}
+
+/**
+ * @brief Key of entry at position
+ *
+ * @param idx pointer to @ref sInterfaceIndex_t
+ * @param pos used position
+ * @return uint32_t entry key
+ */
+static inline uint32_t _this_key(const sInterfaceIndex_t* idx,size_t pos)
+{
+  uint32_t key;
+
+  memcpy(&key,idx->Keys+(size_t)idx->Ids[pos]*idx->Stride,sizeof(key));
+  return key;
+}
+
+/** @}*/
@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceIndex.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceIndex.c (key to entry hash index)
+  * @version  V1.0.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_INDEX_H__
+#define __INTERFACE_INDEX_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Index Interface key index
+ * @brief    Open addressing key to entry id index shared by the dispatch table
+ *           and the keyed queue
+ * @details  Linear probing over a power of two table at load factor <= 0.5,
+ *           home position from the high bits of a Knuth multiplicative hash,
+ *           removal by backward shift (no tombstones). The index keeps entry
+ *           ids only, key of an entry is read from the owner array of entries.
+ * @{
+ */
+
+#define INTERFACE_INDEX_NONE  0xFFFFu   /*!< Empty position, max number of entries*/
+
+/**
+ * @brief Key index
+ *
+ */
+typedef struct
+{
+  uint16_t*       Ids;      /*!< position -> entry id, @ref INTERFACE_INDEX_NONE - empty*/
+  size_t          Bits;     /*!< log2 of number of positions*/
+  const uint8_t*  Keys;     /*!< uint32_t key of entry id at Keys+id*Stride*/
+  size_t          Stride;   /*!< size of owner entry*/
+}sInterfaceIndex_t;
+
+/**
+ * @defgroup Interface_Index_public_func Interface key index public function
+ * @{
+ */
+  bool    InterfaceIndex_Init(sInterfaceIndex_t* idx,size_t MaxEntries,const uint32_t* keys,size_t stride);
+  void    InterfaceIndex_Deinit(sInterfaceIndex_t* idx);
+  void    InterfaceIndex_Clear(sInterfaceIndex_t* idx);
+
+  size_t  InterfaceIndex_Find(const sInterfaceIndex_t* idx,uint32_t key);
+  void    InterfaceIndex_Erase(sInterfaceIndex_t* idx,size_t pos);
+
+  size_t  InterfaceIndex_GetFootprint(const sInterfaceIndex_t* idx);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
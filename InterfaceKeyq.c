@@ -0,0 +1,295 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceKeyq.c
+ * @author   Wyrm
+ * @brief    Keyed frame queue: latest value per key, overwrite oldest
+ * @version  V1.1.1
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Create queue by InterfaceKeyq_ctor(), Deep up to 65534 slots
+  2. InterfaceKeyq_Push(q,data,leng,&key,overwrite):
+     - key NULL            - frame is never replaced
+     - key of queued frame - queued frame is updated in place
+     - overwrite           - full queue drops the oldest frame instead of the new one
+  3. InterfaceKeyq_Pop(q,dst,&leng) takes the oldest frame
+  @note not thread safe, producer and consumer in different contexts must use
+        a critical section (as Interface does for rx circbuff in irq mode)
+*/
+
+
+#include <string.h>
+
+#include "wheap.h"
+
+#include "InterfaceKeyq.h"
+#include "InterfaceIndex.h"
+
+
+/**
+ * @addtogroup Interface_Keyq
+ * @{
+ */
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Queue slot
+ *
+ */
+typedef struct
+{
+  size_t    Leng;
+  uint64_t  Tag;      /*!< user tag of the frame (rx time stamp)*/
+  uint32_t  Key;
+  bool      Keyed;    /*!< slot is in index*/
+}sKeyqSlot_t;
+
+/**
+ * @brief InterfaceKeyq Class
+ *
+ */
+struct InterfaceKeyq
+{
+  size_t              SlotSize;
+  size_t              Deep;
+  size_t              Head;   /*!< oldest slot*/
+  size_t              Count;
+  sKeyqSlot_t*        Slots;
+  uint8_t*            Pool;   /*!< Deep x SlotSize*/
+  sInterfaceIndex_t   Index;  /*!< key -> keyed slot*/
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Keyq_Private_Functions Interface keyed queue private functions
+  * @{
+  */
+  static void           _this_drop_head(InterfaceKeyq_t* cthis);
+/** @}*/
+
+
+/**
+ * @brief InterfaceKeyq Class constructor
+ *
+ * @param SlotSize  max frame size
+ * @param Deep      number of slots
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceKeyq_t* InterfaceKeyq_ctor(size_t SlotSize,size_t Deep)
+{
+  if((SlotSize == 0)||(Deep == 0)||(Deep >= INTERFACE_INDEX_NONE))
+    return NULL;
+
+  InterfaceKeyq_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceKeyq_t)) == NULL)
+    return NULL;
+
+  cthis->SlotSize   = SlotSize;
+  cthis->Deep       = Deep;
+  cthis->Index.Ids  = NULL;
+  cthis->Index.Bits = 0;
+
+  cthis->Slots = heap_malloc(Deep*sizeof(sKeyqSlot_t));
+  cthis->Pool  = heap_malloc(Deep*SlotSize);
+
+  if(cthis->Slots != NULL)
+    memset(cthis->Slots,0,Deep*sizeof(sKeyqSlot_t));
+
+  if((cthis->Slots == NULL)||(cthis->Pool == NULL)||
+     !InterfaceIndex_Init(&cthis->Index,Deep,&cthis->Slots[0].Key,sizeof(sKeyqSlot_t)))
+  {
+    InterfaceKeyq_dtor(cthis);
+    return NULL;
+  }
+
+  InterfaceKeyq_Clear(cthis);
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceKeyq class destructor
+ *
+ * @param cthis pointer to @ref InterfaceKeyq_t
+ */
+void InterfaceKeyq_dtor(InterfaceKeyq_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  heap_free(cthis->Slots);
+  heap_free(cthis->Pool);
+  InterfaceIndex_Deinit(&cthis->Index);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Push frame
+ *
+ * @param cthis     pointer to @ref InterfaceKeyq_t
+ * @param data      frame
+ * @param leng      frame size
+ * @param key       frame key, NULL - unkeyed frame
+ * @param overwrite full queue: true - drop oldest frame, false - drop new frame
+ * @return eInterfaceKeyqPush_t what was done
+ */
+eInterfaceKeyqPush_t InterfaceKeyq_Push(InterfaceKeyq_t* cthis,const uint8_t* data,size_t leng,const uint32_t* key,bool overwrite)
+{
+  return InterfaceKeyq_PushTag(cthis,data,leng,key,overwrite,0);
+}
+
+/**
+ * @brief Push frame with tag, a replaced frame takes the new tag
+ *
+ * @param cthis     pointer to @ref InterfaceKeyq_t
+ * @param data      frame
+ * @param leng      frame size
+ * @param key       frame key, NULL - unkeyed frame
+ * @param overwrite full queue: true - drop oldest frame, false - drop new frame
+ * @param tag       frame tag, see @ref InterfaceKeyq_HeadTag
+ * @return eInterfaceKeyqPush_t what was done
+ */
+eInterfaceKeyqPush_t InterfaceKeyq_PushTag(InterfaceKeyq_t* cthis,const uint8_t* data,size_t leng,const uint32_t* key,bool overwrite,uint64_t tag)
+{
+  if(leng > cthis->SlotSize)
+    return kInterfaceKeyq_Error;
+
+  if(key != NULL)
+  {
+    size_t i = InterfaceIndex_Find(&cthis->Index,*key);
+
+    if(cthis->Index.Ids[i] != INTERFACE_INDEX_NONE)
+    {
+      size_t slot = cthis->Index.Ids[i];
+
+      memcpy(&cthis->Pool[slot*cthis->SlotSize],data,leng);
+      cthis->Slots[slot].Leng = leng;
+      cthis->Slots[slot].Tag  = tag;
+      return kInterfaceKeyq_Replace;
+    }
+  }
+
+  eInterfaceKeyqPush_t ret = kInterfaceKeyq_Append;
+
+  if(cthis->Count == cthis->Deep)
+  {
+    if(!overwrite)
+      return kInterfaceKeyq_Full;
+
+    _this_drop_head(cthis);
+    ret = kInterfaceKeyq_Evict;
+  }
+
+  size_t slot = cthis->Head+cthis->Count;
+  if(slot >= cthis->Deep)
+    slot -= cthis->Deep;
+
+  memcpy(&cthis->Pool[slot*cthis->SlotSize],data,leng);
+  cthis->Slots[slot].Leng  = leng;
+  cthis->Slots[slot].Tag   = tag;
+  cthis->Slots[slot].Keyed = (key != NULL);
+
+  if(key != NULL)
+  {
+    cthis->Slots[slot].Key = *key;
+    cthis->Index.Ids[InterfaceIndex_Find(&cthis->Index,*key)] = (uint16_t)slot; /* find after evict, chain may have moved*/
+  }
+  cthis->Count++;
+
+  return ret;
+}
+
+/**
+ * @brief Pop oldest frame
+ *
+ * @param[in]  cthis pointer to @ref InterfaceKeyq_t
+ * @param[out] dst   output buffer, SlotSize bytes
+ * @param[out] leng  frame size
+ * @return true   if frame taken
+ * @return false  queue is empty
+ */
+bool InterfaceKeyq_Pop(InterfaceKeyq_t* cthis,uint8_t* dst,size_t* leng)
+{
+  if(cthis->Count == 0)
+    return false;
+
+  *leng = cthis->Slots[cthis->Head].Leng;
+  memcpy(dst,&cthis->Pool[cthis->Head*cthis->SlotSize],*leng);
+  _this_drop_head(cthis);
+
+  return true;
+}
+
+/**
+ * @brief Get tag of oldest frame, read it before @ref InterfaceKeyq_Pop
+ *
+ * @param cthis pointer to @ref InterfaceKeyq_t
+ * @return uint64_t tag, 0 if queue is empty
+ */
+uint64_t InterfaceKeyq_HeadTag(InterfaceKeyq_t* cthis)
+{
+  return (cthis->Count != 0) ? cthis->Slots[cthis->Head].Tag : 0;
+}
+
+/**
+ * @brief Drop every queued frame
+ *
+ * @param cthis pointer to @ref InterfaceKeyq_t
+ */
+void InterfaceKeyq_Clear(InterfaceKeyq_t* cthis)
+{
+  cthis->Head  = 0;
+  cthis->Count = 0;
+  InterfaceIndex_Clear(&cthis->Index);
+}
+
+/**
+ * @brief Check queue is empty
+ *
+ * @param cthis pointer to @ref InterfaceKeyq_t
+ * @return true   if empty
+ * @return false  else
+ */
+bool InterfaceKeyq_IsEmpty(InterfaceKeyq_t* cthis) {return cthis->Count == 0;}
+
+/**
+ * @brief Get number of queued frames
+ *
+ * @param cthis pointer to @ref InterfaceKeyq_t
+ * @return size_t queued frames
+ */
+size_t InterfaceKeyq_GetCount(InterfaceKeyq_t* cthis) {return cthis->Count;}
+
+/**
+ * @brief Get queue memory
+ *
+ * @param cthis pointer to @ref InterfaceKeyq_t
+ * @return size_t bytes allocated by queue
+ */
+size_t InterfaceKeyq_GetFootprint(InterfaceKeyq_t* cthis)
+{
+  return sizeof(*cthis)+cthis->Deep*(sizeof(sKeyqSlot_t)+cthis->SlotSize)+InterfaceIndex_GetFootprint(&cthis->Index);
+}
+
+/**
+ * @brief Drop oldest frame
+ *
+ * @param cthis pointer to @ref InterfaceKeyq_t
+ */
+static void _this_drop_head(InterfaceKeyq_t* cthis)
+{
+  if(cthis->Slots[cthis->Head].Keyed)
+    InterfaceIndex_Erase(&cthis->Index,InterfaceIndex_Find(&cthis->Index,cthis->Slots[cthis->Head].Key));
+
+  if(++cthis->Head == cthis->Deep)
+    cthis->Head = 0;
+  cthis->Count--;
+}
+
+/** @}*/
@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceKeyq.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceKeyq.c (keyed frame queue)
+  * @version  V1.1.1
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_KEYQ_H__
+#define __INTERFACE_KEYQ_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Interface.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Keyq Interface keyed queue
+ * @brief    Bounded FIFO of frames with in place update by key
+ * @details  Slots are a ring, so order is kept. A keyed frame whose key is already
+ *           queued overwrites that slot and keeps its place in the line. Key to slot
+ *           index is an open addressing hash, push and pop are O(1).
+ *           Full queue either rejects the new frame or evicts the oldest one.
+ * @{
+ */
+
+/**
+ * @brief Push result
+ *
+ */
+typedef enum
+{
+  kInterfaceKeyq_Append = 0,  /*!< Frame added at tail*/
+  kInterfaceKeyq_Replace,     /*!< Queued frame of the same key updated in place*/
+  kInterfaceKeyq_Evict,       /*!< Oldest frame dropped, frame added at tail*/
+  kInterfaceKeyq_Full,        /*!< Queue full, frame dropped*/
+  kInterfaceKeyq_Error,       /*!< Frame bigger than slot*/
+}eInterfaceKeyqPush_t;
+
+/**
+ * @defgroup Interface_Keyq_public_func Interface keyed queue public function
+ * @{
+ */
+  InterfaceKeyq_t*      InterfaceKeyq_ctor(size_t SlotSize,size_t Deep);
+  void                  InterfaceKeyq_dtor(InterfaceKeyq_t* cthis);
+
+  eInterfaceKeyqPush_t  InterfaceKeyq_Push(InterfaceKeyq_t* cthis,const uint8_t* data,size_t leng,const uint32_t* key,bool overwrite);
+  eInterfaceKeyqPush_t  InterfaceKeyq_PushTag(InterfaceKeyq_t* cthis,const uint8_t* data,size_t leng,const uint32_t* key,bool overwrite,uint64_t tag);
+  uint64_t              InterfaceKeyq_HeadTag(InterfaceKeyq_t* cthis);
+  bool                  InterfaceKeyq_Pop(InterfaceKeyq_t* cthis,uint8_t* dst,size_t* leng);
+  void                  InterfaceKeyq_Clear(InterfaceKeyq_t* cthis);
+
+  bool                  InterfaceKeyq_IsEmpty(InterfaceKeyq_t* cthis);
+  size_t                InterfaceKeyq_GetCount(InterfaceKeyq_t* cthis);
+  size_t                InterfaceKeyq_GetFootprint(InterfaceKeyq_t* cthis);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,253 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceMpsc.c
+ * @author   Wyrm
+ * @brief    Multi-producer single-consumer slot queue for interface tx
+ * @version  V1.1.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Create queue by InterfaceMpsc_ctor(), Deep is rounded up to power of two
+  2. Producer (any thread/task):
+     - slot = InterfaceMpsc_Reserve(q,&ticket), NULL if queue is full
+     - write up to SlotSize bytes into slot
+     - InterfaceMpsc_Commit(q,ticket,leng), leng 0 - slot is skipped by consumer
+       (or InterfaceMpsc_CommitSlot(q,slot,leng) if the ticket is not kept)
+     Every reserved slot must be committed.
+  3. Consumer (one context only):
+     - data = InterfaceMpsc_Peek(q,&leng), NULL if head slot is not committed
+     - InterfaceMpsc_Release(q) when data is not needed anymore
+*/
+
+
+#include <string.h>
+#include <stdatomic.h>
+
+#include "wheap.h"
+
+#include "InterfaceMpsc.h"
+
+
+/**
+ * @addtogroup Interface_Mpsc
+ * @{
+ */
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Queue cell
+ * @details Seq == pos         - free for producer of pos
+ *          Seq == pos+1       - committed, ready for consumer
+ *          Seq == pos+Deep    - released, free for producer of the next lap
+ */
+typedef struct
+{
+  _Atomic(size_t) Seq;
+  size_t          Leng;
+}sMpscCell_t;
+
+/**
+ * @brief InterfaceMpsc Class
+ *
+ */
+struct InterfaceMpsc
+{
+  size_t          SlotSize;
+  size_t          Mask;     /*!< Deep-1*/
+  sMpscCell_t*    Cells;
+  uint8_t*        Pool;     /*!< Deep x SlotSize*/
+  _Atomic(size_t) Head;     /*!< Next position to reserve (producers)*/
+  size_t          Tail;     /*!< Next position to consume (consumer only)*/
+};
+
+
+/**
+ * @brief InterfaceMpsc Class constructor
+ *
+ * @param SlotSize  size of one slot
+ * @param Deep      number of slots (rounded up to power of two)
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceMpsc_t* InterfaceMpsc_ctor(size_t SlotSize,size_t Deep)
+{
+  if((SlotSize == 0)||(Deep == 0))
+    return NULL;
+
+  InterfaceMpsc_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceMpsc_t)) == NULL)
+    return NULL;
+
+  size_t size = 1;
+  while(size < Deep)
+    size <<= 1;
+
+  cthis->SlotSize = SlotSize;
+  cthis->Mask     = size-1;
+  cthis->Cells    = heap_malloc(size*sizeof(sMpscCell_t));
+  cthis->Pool     = heap_malloc(size*SlotSize);
+
+  if((cthis->Cells == NULL)||(cthis->Pool == NULL))
+  {
+    InterfaceMpsc_dtor(cthis);
+    return NULL;
+  }
+
+  for(size_t i = 0; i < size; i++)
+  {
+    atomic_init(&cthis->Cells[i].Seq,i);
+    cthis->Cells[i].Leng = 0;
+  }
+  atomic_init(&cthis->Head,0);
+  cthis->Tail = 0;
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceMpsc class destructor
+ *
+ * @param cthis pointer to @ref InterfaceMpsc_t
+ */
+void InterfaceMpsc_dtor(InterfaceMpsc_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  heap_free(cthis->Cells);
+  heap_free(cthis->Pool);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Reserve slot (producer)
+ *
+ * @param[in]  cthis  pointer to @ref InterfaceMpsc_t
+ * @param[out] ticket slot ticket for @ref InterfaceMpsc_Commit
+ * @return uint8_t* slot memory, NULL if queue is full
+ */
+uint8_t* InterfaceMpsc_Reserve(InterfaceMpsc_t* cthis,size_t* ticket)
+{
+  size_t pos = atomic_load_explicit(&cthis->Head,memory_order_relaxed);
+
+  for(;;)
+  {
+    sMpscCell_t* cell = &cthis->Cells[pos&cthis->Mask];
+    size_t seq = atomic_load_explicit(&cell->Seq,memory_order_acquire);
+    intptr_t diff = (intptr_t)seq-(intptr_t)pos;
+
+    if(diff == 0)
+    {
+      if(atomic_compare_exchange_weak_explicit(&cthis->Head,&pos,pos+1,
+                                               memory_order_relaxed,memory_order_relaxed))
+        break;
+    }
+    else if(diff < 0)
+      return NULL; /* full*/
+    else
+      pos = atomic_load_explicit(&cthis->Head,memory_order_relaxed);
+  }
+
+  *ticket = pos;
+  return &cthis->Pool[(pos&cthis->Mask)*cthis->SlotSize];
+}
+
+/**
+ * @brief Commit reserved slot (producer)
+ *
+ * @param cthis   pointer to @ref InterfaceMpsc_t
+ * @param ticket  ticket from @ref InterfaceMpsc_Reserve
+ * @param leng    used size of slot, 0 - drop
+ */
+void InterfaceMpsc_Commit(InterfaceMpsc_t* cthis,size_t ticket,size_t leng)
+{
+  sMpscCell_t* cell = &cthis->Cells[ticket&cthis->Mask];
+
+  cell->Leng = leng;
+  atomic_store_explicit(&cell->Seq,ticket+1,memory_order_release);
+}
+
+/**
+ * @brief Commit reserved slot by its memory (producer)
+ * @note  ticket of reserved slot is its sequence number, nobody else writes it
+ *        until commit
+ * @param cthis   pointer to @ref InterfaceMpsc_t
+ * @param slot    slot memory from @ref InterfaceMpsc_Reserve
+ * @param leng    used size of slot, 0 - drop
+ */
+void InterfaceMpsc_CommitSlot(InterfaceMpsc_t* cthis,uint8_t* slot,size_t leng)
+{
+  size_t idx = (size_t)(slot-cthis->Pool)/cthis->SlotSize;
+
+  InterfaceMpsc_Commit(cthis,atomic_load_explicit(&cthis->Cells[idx].Seq,memory_order_relaxed),leng);
+}
+
+/**
+ * @brief Get head slot (consumer)
+ *
+ * @param[in]  cthis pointer to @ref InterfaceMpsc_t
+ * @param[out] leng  used size of slot
+ * @return uint8_t* slot memory, NULL if head slot is not committed
+ */
+uint8_t* InterfaceMpsc_Peek(InterfaceMpsc_t* cthis,size_t* leng)
+{
+  sMpscCell_t* cell = &cthis->Cells[cthis->Tail&cthis->Mask];
+
+  if(atomic_load_explicit(&cell->Seq,memory_order_acquire) != cthis->Tail+1)
+    return NULL;
+
+  *leng = cell->Leng;
+  return &cthis->Pool[(cthis->Tail&cthis->Mask)*cthis->SlotSize];
+}
+
+/**
+ * @brief Release head slot (consumer), only after successful @ref InterfaceMpsc_Peek
+ *
+ * @param cthis pointer to @ref InterfaceMpsc_t
+ */
+void InterfaceMpsc_Release(InterfaceMpsc_t* cthis)
+{
+  sMpscCell_t* cell = &cthis->Cells[cthis->Tail&cthis->Mask];
+
+  atomic_store_explicit(&cell->Seq,cthis->Tail+cthis->Mask+1,memory_order_release);
+  cthis->Tail++;
+}
+
+/**
+ * @brief Check queue has no reserved slots (consumer)
+ *
+ * @param cthis pointer to @ref InterfaceMpsc_t
+ * @return true   if empty
+ * @return false  else
+ */
+bool InterfaceMpsc_IsEmpty(InterfaceMpsc_t* cthis)
+{
+  return atomic_load_explicit(&cthis->Head,memory_order_acquire) == cthis->Tail;
+}
+
+/**
+ * @brief Get slot size
+ *
+ * @param cthis pointer to @ref InterfaceMpsc_t
+ * @return size_t slot size
+ */
+size_t InterfaceMpsc_GetSlotSize(InterfaceMpsc_t* cthis) {return cthis->SlotSize;}
+
+/**
+ * @brief Get queue memory
+ *
+ * @param cthis pointer to @ref InterfaceMpsc_t
+ * @return size_t bytes allocated by queue
+ */
+size_t InterfaceMpsc_GetFootprint(InterfaceMpsc_t* cthis)
+{
+  return sizeof(*cthis)+(cthis->Mask+1)*(sizeof(sMpscCell_t)+cthis->SlotSize);
+}
+
+/** @}*/
@@ -0,0 +1,66 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceMpsc.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceMpsc.c (multi-producer single-consumer slot queue)
+  * @version  V1.1.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_MPSC_H__
+#define __INTERFACE_MPSC_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Interface.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Mpsc Interface MPSC slot queue
+ * @brief    Lock-free bounded queue of fixed size slots
+ * @details  Producers reserve a slot, fill it in place and commit it. The single
+ *           consumer takes slots in reservation order, a reserved but not yet
+ *           committed slot holds back the slots behind it. Every slot has its own
+ *           sequence number (Vyukov bounded queue), so there is no shared lock.
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Mpsc_public_func Interface MPSC slot queue public function
+ * @{
+ */
+  InterfaceMpsc_t* InterfaceMpsc_ctor(size_t SlotSize,size_t Deep);
+  void             InterfaceMpsc_dtor(InterfaceMpsc_t* cthis);
+
+  uint8_t*         InterfaceMpsc_Reserve(InterfaceMpsc_t* cthis,size_t* ticket);
+  void             InterfaceMpsc_Commit(InterfaceMpsc_t* cthis,size_t ticket,size_t leng);
+  void             InterfaceMpsc_CommitSlot(InterfaceMpsc_t* cthis,uint8_t* slot,size_t leng);
+
+  uint8_t*         InterfaceMpsc_Peek(InterfaceMpsc_t* cthis,size_t* leng);
+  void             InterfaceMpsc_Release(InterfaceMpsc_t* cthis);
+  bool             InterfaceMpsc_IsEmpty(InterfaceMpsc_t* cthis);
+  size_t           InterfaceMpsc_GetSlotSize(InterfaceMpsc_t* cthis);
+  size_t           InterfaceMpsc_GetFootprint(InterfaceMpsc_t* cthis);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
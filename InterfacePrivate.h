@@ -43,6 +43,29 @@ typedef enum
   eCritical_number_of_elem, /*!< elements number of this enumerate */
 }eCriticalSection;
 
+/**
+ * @brief Driver capability flags, @ref HwInterface_vtable_t Caps
+ * @details interface skips the software stage the driver does in hardware
+ *          (CRC peripheral, DMA engine, HDLC controller, NIC offload)
+ */
+typedef enum
+{
+  kHwCap_RxCrc  = 1u<<0,  /*!< Driver checks rx crc and strips it, bad frames are reported by GetRxStatus*/
+  kHwCap_TxCrc  = 1u<<1,  /*!< Driver appends tx crc*/
+  kHwCap_Framed = 1u<<2,  /*!< Driver delimits frames, no pack/unpack algoritm*/
+}eHwCaps;
+
+/**
+ * @brief Per frame rx status flags, returned by GetRxStatus for the last rx chunk
+ * 
+ */
+typedef enum
+{
+  kHwRx_Ok        = 0,      /*!< Frame is good*/
+  kHwRx_CrcErr    = 1u<<0,  /*!< Hardware crc check failed*/
+  kHwRx_FrameErr  = 1u<<1,  /*!< Hardware framing error (bad delimiter, abort, overrun)*/
+}eHwRxStatus;
+
 /**
  * @brief   Interface callback struct 
  * @details use it if you need notify parent in IRQ
@@ -80,6 +103,11 @@ typedef struct {
     size_t  (*GetMaxDataLeng)(void* /*this*/);
     
     sInterfaceIrqCallback_t *irqcb;
+
+    bool    (*GetRxTs)(void* /*this*/,uint64_t* /*ts*/);                                        /*!< Optional, arrival time of last rx chunk in clock of Interface_SetRxTimestamps, NULL - none*/
+
+    uint32_t  Caps;                                                                              /*!< @ref eHwCaps flags, 0 - everything in software*/
+    uint32_t  (*GetRxStatus)(void* /*this*/);                                                    /*!< Optional, @ref eHwRxStatus of last rx chunk, NULL - always ok*/
 }HwInterface_vtable_t;
 
 
@@ -3,8 +3,8 @@
  * @file     InterfacePrivateWrapper.h
  * @author   Wyrm
  * @brief    This file provides code for @ref HWInterface_t wrapper macro/functions
- * @version  V1.0.1
- * @date     29. Apr. 2026
+ * @version  V1.2.0
+ * @date     19. Oct. 2026
  *************************************************************************
  */
  
@@ -56,6 +56,9 @@ extern "C"{
   static bool HwConnect(void* this_ptr);
   static bool HwDisconnect(void* this_ptr);
   static void HwSetCB(void* this_ptr,sInterfaceIrqCallback_t* p_cb);
+  static bool HwGetRxTs(void* this_ptr,uint64_t* ts);
+  static uint32_t HwGetCaps(void* this_ptr);
+  static uint32_t HwGetRxStatus(void* this_ptr);
   /** @}*/ /* End of Interface @ref HWInterface_t functions wraper group*/
 /* Exported functions -------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
@@ -170,6 +173,41 @@ static void HwSetCB(void* this_ptr,sInterfaceIrqCallback_t* p_cb)
   CONVERT_TO_HW(this_ptr)->vtable->irqcb = p_cb;
 }
 
+/**
+ * @brief Wrapper of @ref HWInterface_t optional rx time stamp
+ * 
+ * @param this_ptr  pointer to @ref HWInterface_t
+ * @param ts        arrival time of last rx chunk
+ * @return true     if driver has time stamp
+ * @return false    no hook or no time stamp
+ */
+static bool HwGetRxTs(void* this_ptr,uint64_t* ts)
+{
+  return (CONVERT_TO_HW(this_ptr)->vtable->GetRxTs != NULL)&&CONVERT_TO_HW(this_ptr)->vtable->GetRxTs(this_ptr,ts);
+}
+
+/**
+ * @brief Wrapper of @ref HWInterface_t capability flags
+ * 
+ * @param this_ptr  pointer to @ref HWInterface_t
+ * @return uint32_t @ref eHwCaps flags
+ */
+static uint32_t HwGetCaps(void* this_ptr)
+{
+  return CONVERT_TO_HW(this_ptr)->vtable->Caps;
+}
+
+/**
+ * @brief Wrapper of @ref HWInterface_t optional rx status
+ * 
+ * @param this_ptr  pointer to @ref HWInterface_t
+ * @return uint32_t @ref eHwRxStatus of last rx chunk, @ref kHwRx_Ok if no hook
+ */
+static uint32_t HwGetRxStatus(void* this_ptr)
+{
+  return (CONVERT_TO_HW(this_ptr)->vtable->GetRxStatus != NULL) ? CONVERT_TO_HW(this_ptr)->vtable->GetRxStatus(this_ptr) : kHwRx_Ok;
+}
+
 #else /* #ifdef INTERFACE_PRIVATE_WRAPPER_USE_MACRO */
 
 /**
@@ -293,6 +331,32 @@ static void HwSetCB(void* this_ptr,sInterfaceIrqCallback_t* p_cb)
  */
 #define HwGetMaxDataLeng(this_ptr)  CONVERT_TO_HW(this_ptr)->vtable->GetMaxDataLeng(this_ptr)
 
+/**
+ * @brief Wrapper of @ref HWInterface_t optional rx time stamp
+ * 
+ * @param this_ptr  pointer to @ref HWInterface_t
+ * @param ts        arrival time of last rx chunk
+ * @return true    if driver has time stamp
+ * @return false   no hook or no time stamp
+ */
+#define HwGetRxTs(this_ptr,ts)  ((CONVERT_TO_HW(this_ptr)->vtable->GetRxTs != NULL)&&CONVERT_TO_HW(this_ptr)->vtable->GetRxTs(this_ptr,ts))
+
+/**
+ * @brief Wrapper of @ref HWInterface_t capability flags
+ * 
+ * @param this_ptr  pointer to @ref HWInterface_t
+ * @return uint32_t @ref eHwCaps flags
+ */
+#define HwGetCaps(this_ptr)  (CONVERT_TO_HW(this_ptr)->vtable->Caps)
+
+/**
+ * @brief Wrapper of @ref HWInterface_t optional rx status
+ * 
+ * @param this_ptr  pointer to @ref HWInterface_t
+ * @return uint32_t @ref eHwRxStatus of last rx chunk, @ref kHwRx_Ok if no hook
+ */
+#define HwGetRxStatus(this_ptr)  ((CONVERT_TO_HW(this_ptr)->vtable->GetRxStatus != NULL) ? CONVERT_TO_HW(this_ptr)->vtable->GetRxStatus(this_ptr) : (uint32_t)kHwRx_Ok)
+
 #endif /* #ifdef INTERFACE_PRIVATE_WRAPPER_USE_MACRO */
 
 #ifdef __cplusplus
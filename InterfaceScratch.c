@@ -0,0 +1,194 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceScratch.c
+ * @author   Wyrm
+ * @brief    Scratch buffer pool shared by many @ref InterfaceHandel_t
+ * @version  V1.0.1
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Create pool by InterfaceScratch_ctor(): Size >= IntBuffSize of interfaces,
+     Count = 1 and SingleContext = true for interfaces served by one process thread
+  2. Link every interface by Interface_SetScratch(), its own Pack buffer is freed
+  3. Pool must live longer than linked interfaces
+  @note Acquire/Release are lock-free, frame is dropped if pool is empty
+*/
+
+
+#include <string.h>
+#include <stdatomic.h>
+
+#include "wheap.h"
+
+#include "InterfaceScratch.h"
+
+
+/**
+ * @addtogroup Interface_Scratch
+ * @{
+ */
+
+/**
+ * @brief InterfaceScratch Class
+ *
+ */
+struct InterfaceScratch
+{
+  size_t            Size;
+  size_t            Count;
+  _Atomic(uint32_t) Free;     /*!< bit per free buffer*/
+  _Atomic(uint32_t) Misses;   /*!< Acquire on empty pool*/
+  bool              Single;   /*!< one context, no read-modify-write needed*/
+  uint8_t*          Pool;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Scratch_Private_Functions Interface scratch pool private functions
+  * @{
+  */
+  static inline size_t _this_bit_index(uint32_t bit);
+/** @}*/
+
+
+/**
+ * @brief InterfaceScratch Class constructor
+ *
+ * @param Size  size of one buffer
+ * @param Count number of buffers (1..@ref INTERFACE_SCRATCH_MAX_COUNT)
+ * @param SingleContext true - pool is used from one thread without nesting
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceScratch_t* InterfaceScratch_ctor(size_t Size,size_t Count,bool SingleContext)
+{
+  if((Size == 0)||(Count == 0)||(Count > INTERFACE_SCRATCH_MAX_COUNT))
+    return NULL;
+
+  InterfaceScratch_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceScratch_t)) == NULL)
+    return NULL;
+
+  if((cthis->Pool = heap_malloc(Size*Count)) == NULL)
+  {
+    heap_free(cthis);
+    return NULL;
+  }
+
+  cthis->Size  = Size;
+  cthis->Count = Count;
+  cthis->Single = SingleContext;
+  atomic_init(&cthis->Free,(Count == 32u) ? UINT32_MAX : ((1u << Count)-1u));
+  atomic_init(&cthis->Misses,0);
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceScratch class destructor
+ *
+ * @param cthis pointer to @ref InterfaceScratch_t
+ */
+void InterfaceScratch_dtor(InterfaceScratch_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  heap_free(cthis->Pool);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Take free buffer
+ *
+ * @param cthis pointer to @ref InterfaceScratch_t
+ * @return uint8_t* buffer, NULL if all are in use
+ */
+uint8_t* InterfaceScratch_Acquire(InterfaceScratch_t* cthis)
+{
+  uint32_t free = atomic_load_explicit(&cthis->Free,memory_order_relaxed);
+
+  if(cthis->Single && (free != 0))
+  {
+    uint32_t bit = free & (~free+1u);
+
+    atomic_store_explicit(&cthis->Free,free & ~bit,memory_order_relaxed);
+    return &cthis->Pool[_this_bit_index(bit)*cthis->Size];
+  }
+
+  while(free != 0)
+  {
+    uint32_t bit = free & (~free+1u); /* lowest free*/
+
+    if(atomic_compare_exchange_weak_explicit(&cthis->Free,&free,free & ~bit,
+                                             memory_order_acquire,memory_order_relaxed))
+      return &cthis->Pool[_this_bit_index(bit)*cthis->Size];
+  }
+
+  atomic_fetch_add_explicit(&cthis->Misses,1,memory_order_relaxed);
+  return NULL;
+}
+
+/**
+ * @brief Give buffer back
+ *
+ * @param cthis pointer to @ref InterfaceScratch_t
+ * @param buff  buffer from @ref InterfaceScratch_Acquire
+ */
+void InterfaceScratch_Release(InterfaceScratch_t* cthis,uint8_t* buff)
+{
+  size_t idx = (size_t)(buff-cthis->Pool)/cthis->Size;
+
+  if(cthis->Single)
+    atomic_store_explicit(&cthis->Free,atomic_load_explicit(&cthis->Free,memory_order_relaxed)|(1u << idx),memory_order_relaxed);
+  else
+    atomic_fetch_or_explicit(&cthis->Free,1u << idx,memory_order_release);
+}
+
+/**
+ * @brief Get buffer size
+ *
+ * @param cthis pointer to @ref InterfaceScratch_t
+ * @return size_t buffer size
+ */
+size_t InterfaceScratch_GetSize(InterfaceScratch_t* cthis) {return cthis->Size;}
+
+/**
+ * @brief Get pool memory
+ *
+ * @param cthis pointer to @ref InterfaceScratch_t
+ * @return size_t bytes allocated by pool
+ */
+size_t InterfaceScratch_GetFootprint(InterfaceScratch_t* cthis) {return sizeof(*cthis)+cthis->Size*cthis->Count;}
+
+/**
+ * @brief Get number of frames dropped on empty pool
+ *
+ * @param cthis pointer to @ref InterfaceScratch_t
+ * @return uint32_t misses
+ */
+uint32_t InterfaceScratch_GetMisses(InterfaceScratch_t* cthis) {return atomic_load_explicit(&cthis->Misses,memory_order_relaxed);}
+
+/**
+ * @brief Index of single set bit (de Bruijn multiply, no compiler builtins)
+ *
+ * @param bit value with exactly one bit set
+ * @return size_t bit position 0..31
+ */
+static inline size_t _this_bit_index(uint32_t bit)
+{
+  static const uint8_t pos[32] =
+  {
+     0, 1,28, 2,29,14,24, 3,30,22,20,15,25,17, 4, 8,
+    31,27,13,23,21,19,16, 7,26,12,18, 6,11, 5,10, 9,
+  };
+
+  return pos[(uint32_t)(bit*0x077CB531u) >> 27];
+}
+
+/** @}*/
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceScratch.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceScratch.c (shared rx scratch buffer pool)
+  * @version  V1.0.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_SCRATCH_H__
+#define __INTERFACE_SCRATCH_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Interface.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Scratch Interface scratch pool
+ * @brief    Pack buffers shared by many interfaces
+ * @details  A buffer is taken only for the time of one frame parse. Create one pool
+ *           per thread (process mode) or per core, with Count = max number of
+ *           parses that can nest (irq priorities sharing the pool).
+ *           SingleContext pool (one thread, no nesting) skips atomic read-modify-write.
+ * @{
+ */
+
+#define INTERFACE_SCRATCH_MAX_COUNT   32u   /*!< Max buffers in one pool*/
+
+/**
+ * @defgroup Interface_Scratch_public_func Interface scratch pool public function
+ * @{
+ */
+  InterfaceScratch_t* InterfaceScratch_ctor(size_t Size,size_t Count,bool SingleContext);
+  void                InterfaceScratch_dtor(InterfaceScratch_t* cthis);
+
+  uint8_t*            InterfaceScratch_Acquire(InterfaceScratch_t* cthis);
+  void                InterfaceScratch_Release(InterfaceScratch_t* cthis,uint8_t* buff);
+
+  size_t              InterfaceScratch_GetSize(InterfaceScratch_t* cthis);
+  size_t              InterfaceScratch_GetFootprint(InterfaceScratch_t* cthis);
+  uint32_t            InterfaceScratch_GetMisses(InterfaceScratch_t* cthis);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,258 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceCapture.c
+ * @author   Wyrm
+ * @brief    Rx capture file writer for Linux host
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Create writer by InterfaceCapture_ctor(path,BuffSize), file is created or
+     appended (header is written to empty file only)
+  2. Interface_SetCapture(iface,InterfaceCapture_GetTap(cap)): every raw chunk
+     read from driver is recorded before parsing
+  3. Interface_SetCapture(iface,NULL), then InterfaceCapture_dtor() flushes buffer
+  4. Replay the file by InterfaceReplay driver
+  @note writer is not thread safe, tap runs in driver context of one interface
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "wheap.h"
+
+#include "InterfaceCapture.h"
+
+
+/**
+ * @addtogroup Interface_Capture
+ * @{
+ */
+
+/**
+ * @brief InterfaceCapture Class
+ *
+ */
+struct InterfaceCapture
+{
+  int             fd;
+  uint8_t*        Buff;
+  size_t          BuffSize;
+  size_t          Used;
+  uint64_t        Lost;     /*!< Chunks not written (write error)*/
+  sInterfaceTap_t tap;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Capture_Private_Functions Interface capture private functions
+  * @{
+  */
+  static void   _this_tap(void* parent,const uint8_t* data,size_t len);
+  static bool   _this_write_all(int fd,const uint8_t* data,size_t len);
+/** @}*/
+
+
+/**
+ * @brief InterfaceCapture Class constructor
+ *
+ * @param path      capture file
+ * @param BuffSize  write buffer size, chunks bigger than buffer are written directly
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceCapture_t* InterfaceCapture_ctor(const char* path,size_t BuffSize)
+{
+  if((path == NULL)||(BuffSize < sizeof(sInterfaceCaptureRec_t)))
+    return NULL;
+
+  InterfaceCapture_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceCapture_t)) == NULL)
+    return NULL;
+
+  cthis->BuffSize   = BuffSize;
+  cthis->Used       = 0;
+  cthis->Lost       = 0;
+  cthis->tap.parent = cthis;
+  cthis->tap.func   = _this_tap;
+
+  if((cthis->Buff = heap_malloc(BuffSize)) == NULL)
+  {
+    heap_free(cthis);
+    return NULL;
+  }
+
+  struct stat st;
+
+  if(((cthis->fd = open(path,O_WRONLY|O_CREAT|O_APPEND|O_CLOEXEC,0644)) < 0)
+   ||(fstat(cthis->fd,&st) != 0))
+  {
+    if(cthis->fd >= 0)
+      close(cthis->fd);
+    heap_free(cthis->Buff);
+    heap_free(cthis);
+    return NULL;
+  }
+
+  if(st.st_size == 0)
+  {
+    sInterfaceCaptureHead_t head = {.Magic = INTERFACE_CAPTURE_MAGIC,.Version = INTERFACE_CAPTURE_VERSION,.Reserved = 0};
+
+    memcpy(cthis->Buff,&head,sizeof(head));
+    cthis->Used = sizeof(head);
+  }
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceCapture class destructor, flushes buffer
+ *
+ * @param cthis pointer to @ref InterfaceCapture_t
+ */
+void InterfaceCapture_dtor(InterfaceCapture_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  InterfaceCapture_Flush(cthis);
+  close(cthis->fd);
+  heap_free(cthis->Buff);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Get tap for @ref Interface_SetCapture
+ *
+ * @param cthis pointer to @ref InterfaceCapture_t
+ * @return const sInterfaceTap_t* tap recording to this file
+ */
+const sInterfaceTap_t* InterfaceCapture_GetTap(InterfaceCapture_t* cthis) {return &cthis->tap;}
+
+/**
+ * @brief Record chunk with current time stamp
+ *
+ * @param cthis pointer to @ref InterfaceCapture_t
+ * @param data  chunk
+ * @param len   chunk leng
+ * @return true   if recorded (buffered)
+ * @return false  write error, chunk lost
+ */
+bool InterfaceCapture_Write(InterfaceCapture_t* cthis,const uint8_t* data,size_t len)
+{
+  struct timespec        ts;
+  sInterfaceCaptureRec_t rec;
+  size_t                 size = sizeof(rec)+INTERFACE_CAPTURE_ALIGN(len);
+
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  rec.TsNs     = (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+  rec.Leng     = (uint32_t)len;
+  rec.Reserved = 0;
+
+  if((cthis->Used+size > cthis->BuffSize)&&!InterfaceCapture_Flush(cthis))
+  {
+    cthis->Lost++;
+    return false;
+  }
+
+  if(size > cthis->BuffSize)
+  {
+    static const uint8_t pad[8] = {0};
+
+    /* huge chunk, straight to file, buffer is empty here*/
+    if(!_this_write_all(cthis->fd,(const uint8_t*)&rec,sizeof(rec))
+     ||!_this_write_all(cthis->fd,data,len)
+     ||!_this_write_all(cthis->fd,pad,INTERFACE_CAPTURE_ALIGN(len)-len))
+    {
+      cthis->Lost++;
+      return false;
+    }
+    return true;
+  }
+
+  uint8_t* dst = cthis->Buff+cthis->Used;
+
+  memcpy(dst,&rec,sizeof(rec));
+  memcpy(dst+sizeof(rec),data,len);
+  memset(dst+sizeof(rec)+len,0,INTERFACE_CAPTURE_ALIGN(len)-len);
+  cthis->Used += size;
+
+  return true;
+}
+
+/**
+ * @brief Write buffered records to file
+ *
+ * @param cthis pointer to @ref InterfaceCapture_t
+ * @return true   if buffer written
+ * @return false  write error, buffered records dropped
+ */
+bool InterfaceCapture_Flush(InterfaceCapture_t* cthis)
+{
+  bool state = _this_write_all(cthis->fd,cthis->Buff,cthis->Used);
+
+  cthis->Used = 0;
+  return state;
+}
+
+/**
+ * @brief Get number of chunks lost on write errors
+ *
+ * @param cthis pointer to @ref InterfaceCapture_t
+ * @return uint64_t lost chunks
+ */
+uint64_t InterfaceCapture_GetLost(InterfaceCapture_t* cthis) {return cthis->Lost;}
+
+/**
+ * @brief Interface capture tap
+ *
+ * @param parent pointer to @ref InterfaceCapture_t
+ * @param data   raw chunk
+ * @param len    chunk leng
+ */
+static void _this_tap(void* parent,const uint8_t* data,size_t len)
+{
+  InterfaceCapture_Write((InterfaceCapture_t*)parent,data,len);
+}
+
+/**
+ * @brief write() until everything is written
+ *
+ * @param fd    file
+ * @param data  data
+ * @param len   data leng
+ * @return true   if written
+ * @return false  write error
+ */
+static bool _this_write_all(int fd,const uint8_t* data,size_t len)
+{
+  while(len != 0)
+  {
+    ssize_t ret = write(fd,data,len);
+
+    if(ret < 0)
+    {
+      if(errno == EINTR)
+        continue;
+      return false;
+    }
+    data += ret;
+    len  -= (size_t)ret;
+  }
+  return true;
+}
+
+/** @}*/
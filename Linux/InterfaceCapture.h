@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceCapture.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceCapture.c (rx capture file writer)
+  * @version  V1.0.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_CAPTURE_H__
+#define __INTERFACE_CAPTURE_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Interface.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Capture Interface Linux rx capture
+ * @brief    Append-only file of raw driver rx chunks with time stamps
+ * @details  File: @ref sInterfaceCaptureHead_t, then records of
+ *           @ref sInterfaceCaptureRec_t + chunk, padded to 8 bytes. All fields
+ *           are host byte order. Records are buffered and written by one write()
+ *           when buffer is full, on @ref InterfaceCapture_Flush and on destruction.
+ * @{
+ */
+
+#define INTERFACE_CAPTURE_MAGIC     0x50414346u /*!< "FCAP"*/
+#define INTERFACE_CAPTURE_VERSION   1u
+#define INTERFACE_CAPTURE_ALIGN(x)  (((x)+7u)&~(size_t)7u)
+
+typedef struct InterfaceCapture InterfaceCapture_t;   /*!< Interface capture Class typedef*/
+
+/**
+ * @brief Capture file header
+ *
+ */
+typedef struct
+{
+  uint32_t  Magic;      /*!< @ref INTERFACE_CAPTURE_MAGIC*/
+  uint32_t  Version;    /*!< @ref INTERFACE_CAPTURE_VERSION*/
+  uint64_t  Reserved;
+}sInterfaceCaptureHead_t;
+
+/**
+ * @brief Capture record header
+ *
+ */
+typedef struct
+{
+  uint64_t  TsNs;       /*!< CLOCK_MONOTONIC of chunk*/
+  uint32_t  Leng;       /*!< Chunk leng*/
+  uint32_t  Reserved;
+}sInterfaceCaptureRec_t;
+
+/**
+ * @defgroup Interface_Capture_public_func Interface capture public function
+ * @{
+ */
+  InterfaceCapture_t*     InterfaceCapture_ctor(const char* path,size_t BuffSize);
+  void                    InterfaceCapture_dtor(InterfaceCapture_t* cthis);
+
+  const sInterfaceTap_t*  InterfaceCapture_GetTap(InterfaceCapture_t* cthis);
+  bool                    InterfaceCapture_Write(InterfaceCapture_t* cthis,const uint8_t* data,size_t len);
+  bool                    InterfaceCapture_Flush(InterfaceCapture_t* cthis);
+  uint64_t                InterfaceCapture_GetLost(InterfaceCapture_t* cthis);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
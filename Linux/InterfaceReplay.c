@@ -0,0 +1,316 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceReplay.c
+ * @author   Wyrm
+ * @brief    Capture file replay driver for Linux host
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Open capture by InterfaceReplay_ctor(path,paced)
+  2. Create interface on InterfaceReplay_GetHw(), internal buffer of at least
+     InterfaceReplay_GetMaxChunk() (bigger chunks are skipped)
+  3. Set up the pipeline as in the field, call Interface_process (or a runner)
+     until InterfaceReplay_IsDone()
+  4. InterfaceReplay_Rewind() starts over (paced clock restarts too)
+  @note driver supports kInterfaceRxTx_process mode only
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "wheap.h"
+
+#include "InterfaceReplay.h"
+#include "InterfaceCapture.h"
+
+
+/**
+ * @addtogroup Interface_Replay
+ * @{
+ */
+
+/**
+ * @brief InterfaceReplay Class
+ *
+ */
+struct InterfaceReplay
+{
+  HWInterface_t           base;     /*!< must be first*/
+  HwInterface_vtable_t    vtable;
+
+  const uint8_t*          Map;
+  size_t                  MapSize;
+  size_t                  Size;     /*!< end of last complete record*/
+  size_t                  Pos;      /*!< next record offset*/
+  size_t                  MaxChunk;
+
+  bool                    Paced;
+  uint64_t                FirstTs;  /*!< recorded time of first record*/
+  uint64_t                StartNs;  /*!< replay start, 0 - not started*/
+
+  sInterfaceReplayStats_t stats;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Replay_Private_Functions Interface replay driver private functions
+  * @{
+  */
+  static inline uint64_t  _this_now(void);
+  static const sInterfaceCaptureRec_t* _this_rec(const InterfaceReplay_t* cthis,size_t pos);
+  static void   _this_set_buff(void* hw,uint8_t* data,size_t len);
+  static void   _this_nop(void* hw);
+  static bool   _this_true(void* hw);
+  static bool   _this_send(void* hw,const uint8_t* data,size_t len);
+  static bool   _this_read(void* hw,uint8_t* data,size_t* len,size_t max_len);
+  static size_t _this_max(void* hw);
+/** @}*/
+
+
+/**
+ * @brief InterfaceReplay Class constructor
+ *
+ * @param path  capture file of @ref InterfaceCapture_t
+ * @param paced true - keep recorded timing, false - as fast as possible
+ * @return pointer to allocated class, NULL if error or not a capture file
+ */
+InterfaceReplay_t* InterfaceReplay_ctor(const char* path,bool paced)
+{
+  if(path == NULL)
+    return NULL;
+
+  int         fd = open(path,O_RDONLY|O_CLOEXEC);
+  struct stat st;
+
+  if(fd < 0)
+    return NULL;
+  if((fstat(fd,&st) != 0)||((size_t)st.st_size < sizeof(sInterfaceCaptureHead_t)))
+  {
+    close(fd);
+    return NULL;
+  }
+
+  void* map = mmap(NULL,(size_t)st.st_size,PROT_READ,MAP_PRIVATE|MAP_POPULATE,fd,0);
+  close(fd);
+  if(map == MAP_FAILED)
+    return NULL;
+  madvise(map,(size_t)st.st_size,MADV_SEQUENTIAL);
+
+  const sInterfaceCaptureHead_t* head = map;
+  InterfaceReplay_t*             cthis = NULL;
+
+  if((head->Magic != INTERFACE_CAPTURE_MAGIC)||(head->Version != INTERFACE_CAPTURE_VERSION)
+   ||((cthis = heap_malloc_cast(InterfaceReplay_t)) == NULL))
+  {
+    munmap(map,(size_t)st.st_size);
+    return NULL;
+  }
+
+  memset(cthis,0,sizeof(*cthis));
+  cthis->Map     = map;
+  cthis->MapSize = (size_t)st.st_size;
+  cthis->Size    = (size_t)st.st_size;
+  cthis->Paced = paced;
+
+  /* scan once: max chunk, first time stamp, cut torn tail record*/
+  const sInterfaceCaptureRec_t* rec;
+  size_t pos = sizeof(sInterfaceCaptureHead_t);
+
+  for(; (rec = _this_rec(cthis,pos)) != NULL; pos += sizeof(*rec)+INTERFACE_CAPTURE_ALIGN(rec->Leng))
+  {
+    if(pos == sizeof(sInterfaceCaptureHead_t))
+      cthis->FirstTs = rec->TsNs;
+    if(rec->Leng > cthis->MaxChunk)
+      cthis->MaxChunk = rec->Leng;
+  }
+  cthis->Size = pos;
+
+  cthis->vtable.SetRxBuff       = _this_set_buff;
+  cthis->vtable.SetTxBuff       = _this_set_buff;
+  cthis->vtable.EnterCriticalRx = _this_nop;
+  cthis->vtable.ExitCriticalRx  = _this_nop;
+  cthis->vtable.EnterCriticalTx = _this_nop;
+  cthis->vtable.ExitCriticalTx  = _this_nop;
+  cthis->vtable.Connect         = _this_true;
+  cthis->vtable.Disconnect      = _this_true;
+  cthis->vtable.Process         = _this_nop;
+  cthis->vtable.IsFree          = _this_true;
+  cthis->vtable.SendData        = _this_send;
+  cthis->vtable.ReadRxBuff      = _this_read;
+  cthis->vtable.GetMaxDataLeng  = _this_max;
+  cthis->base.vtable            = &cthis->vtable;
+
+  InterfaceReplay_Rewind(cthis);
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceReplay class destructor
+ *
+ * @param cthis pointer to @ref InterfaceReplay_t
+ */
+void InterfaceReplay_dtor(InterfaceReplay_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  munmap((void*)cthis->Map,cthis->MapSize);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Get driver for @ref Interface_ctor
+ *
+ * @param cthis pointer to @ref InterfaceReplay_t
+ * @return HWInterface_t* driver
+ */
+HWInterface_t* InterfaceReplay_GetHw(InterfaceReplay_t* cthis) {return &cthis->base;}
+
+/**
+ * @brief Get biggest recorded chunk
+ *
+ * @param cthis pointer to @ref InterfaceReplay_t
+ * @return size_t min interface buffer size
+ */
+size_t InterfaceReplay_GetMaxChunk(InterfaceReplay_t* cthis) {return cthis->MaxChunk;}
+
+/**
+ * @brief Check every chunk was returned
+ *
+ * @param cthis pointer to @ref InterfaceReplay_t
+ * @return true   if end of capture
+ * @return false  else
+ */
+bool InterfaceReplay_IsDone(InterfaceReplay_t* cthis) {return cthis->Pos >= cthis->Size;}
+
+/**
+ * @brief Start replay from first record
+ *
+ * @param cthis pointer to @ref InterfaceReplay_t
+ */
+void InterfaceReplay_Rewind(InterfaceReplay_t* cthis)
+{
+  cthis->Pos     = sizeof(sInterfaceCaptureHead_t);
+  cthis->StartNs = 0;
+}
+
+/**
+ * @brief Get replay statistic
+ *
+ * @param[in]  cthis pointer to @ref InterfaceReplay_t
+ * @param[out] stats pointer to @ref sInterfaceReplayStats_t
+ */
+void InterfaceReplay_GetStats(InterfaceReplay_t* cthis,sInterfaceReplayStats_t* stats) {*stats = cthis->stats;}
+
+/**
+ * @brief Get monotonic clock in ns
+ *
+ * @return uint64_t ns
+ */
+static inline uint64_t _this_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Get complete record at pos
+ *
+ * @param cthis pointer to @ref InterfaceReplay_t
+ * @param pos   record offset
+ * @return const sInterfaceCaptureRec_t* record, NULL - end or torn record
+ */
+static const sInterfaceCaptureRec_t* _this_rec(const InterfaceReplay_t* cthis,size_t pos)
+{
+  if(pos+sizeof(sInterfaceCaptureRec_t) > cthis->Size)
+    return NULL;
+
+  const sInterfaceCaptureRec_t* rec = (const sInterfaceCaptureRec_t*)(cthis->Map+pos);
+
+  if(rec->Leng > cthis->Size-pos-sizeof(*rec))
+    return NULL;
+
+  return rec;
+}
+
+static void _this_set_buff(void* hw,uint8_t* data,size_t len) {(void)hw;(void)data;(void)len;}
+static void _this_nop(void* hw)                                {(void)hw;}
+static bool _this_true(void* hw)                               {(void)hw;return true;}
+
+/**
+ * @brief Driver send, frame is counted and dropped
+ *
+ */
+static bool _this_send(void* hw,const uint8_t* data,size_t len)
+{
+  InterfaceReplay_t* cthis = hw;
+
+  (void)data;
+  cthis->stats.TxFrames++;
+  cthis->stats.TxBytes += len;
+  return true;
+}
+
+/**
+ * @brief Driver read, next recorded chunk
+ *
+ */
+static bool _this_read(void* hw,uint8_t* data,size_t* len,size_t max_len)
+{
+  InterfaceReplay_t*            cthis = hw;
+  const sInterfaceCaptureRec_t* rec;
+
+  while((rec = _this_rec(cthis,cthis->Pos)) != NULL)
+  {
+    if(cthis->Paced)
+    {
+      uint64_t now = _this_now();
+
+      if(cthis->StartNs == 0)
+        cthis->StartNs = now;
+      if(now-cthis->StartNs < rec->TsNs-cthis->FirstTs)
+        return false; /* not due yet*/
+    }
+
+    cthis->Pos += sizeof(*rec)+INTERFACE_CAPTURE_ALIGN(rec->Leng);
+
+    if(rec->Leng > max_len)
+    {
+      cthis->stats.Skipped++;
+      continue;
+    }
+
+    memcpy(data,rec+1,rec->Leng);
+    *len = rec->Leng;
+    cthis->stats.Chunks++;
+    cthis->stats.Bytes += rec->Leng;
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Driver max frame
+ *
+ */
+static size_t _this_max(void* hw) {return ((InterfaceReplay_t*)hw)->MaxChunk;}
+
+/** @}*/
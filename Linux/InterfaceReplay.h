@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceReplay.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceReplay.c (capture file replay driver)
+  * @version  V1.0.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_REPLAY_H__
+#define __INTERFACE_REPLAY_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Interface.h"
+#include "InterfacePrivate.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Replay Interface Linux capture replay driver
+ * @brief    @ref HWInterface_t feeding a capture file to the rx path
+ * @details  File of @ref Interface_Capture is mmap-ed read only, every ReadRxBuff
+ *           returns the next recorded chunk, so the whole rx path (parser, stages,
+ *           filters, queues) runs as with the real driver. Paced mode returns a
+ *           chunk only when its recorded time offset has passed, fast mode returns
+ *           chunks back to back. Sent frames are counted and dropped.
+ * @{
+ */
+
+typedef struct InterfaceReplay InterfaceReplay_t;   /*!< Interface replay driver Class typedef*/
+
+/**
+ * @brief Replay statistic
+ *
+ */
+typedef struct
+{
+  uint64_t  Chunks;     /*!< Chunks returned by ReadRxBuff*/
+  uint64_t  Bytes;      /*!< Bytes returned by ReadRxBuff*/
+  uint64_t  Skipped;    /*!< Chunks bigger than rx buffer*/
+  uint64_t  TxFrames;   /*!< Frames sent (dropped)*/
+  uint64_t  TxBytes;
+}sInterfaceReplayStats_t;
+
+/**
+ * @defgroup Interface_Replay_public_func Interface replay driver public function
+ * @{
+ */
+  InterfaceReplay_t*  InterfaceReplay_ctor(const char* path,bool paced);
+  void                InterfaceReplay_dtor(InterfaceReplay_t* cthis);
+
+  HWInterface_t*      InterfaceReplay_GetHw(InterfaceReplay_t* cthis);
+  size_t              InterfaceReplay_GetMaxChunk(InterfaceReplay_t* cthis);
+  bool                InterfaceReplay_IsDone(InterfaceReplay_t* cthis);
+  void                InterfaceReplay_Rewind(InterfaceReplay_t* cthis);
+  void                InterfaceReplay_GetStats(InterfaceReplay_t* cthis,sInterfaceReplayStats_t* stats);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
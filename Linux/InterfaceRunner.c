@@ -0,0 +1,273 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceRunner.c
+ * @author   Wyrm
+ * @brief    Adaptive busy-poll / sleep runner of Interface_process for Linux host
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Interface must be in kInterfaceRxTx_process mode
+  2. Create runner by InterfaceRunner_ctor(), it installs Interface tx notify
+  3. Run InterfaceRunner_Run() in own thread, or call InterfaceRunner_Step()
+     from an existing loop
+  4. InterfaceRunner_Stop() from any thread, then InterfaceRunner_dtor()
+  @note InterfaceRunner_Wake() is async-signal-safe, use it to wake runner from
+        driver callbacks which do not make WaitFd readable
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <string.h>
+#include <stdatomic.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include "wheap.h"
+
+#include "InterfaceRunner.h"
+
+
+/**
+ * @addtogroup Interface_Runner
+ * @{
+ */
+
+/**
+ * @brief InterfaceRunner Class
+ *
+ */
+struct InterfaceRunner
+{
+  InterfaceHandel_t*      iface;
+  sInterfaceRunnerCfg_t   cfg;
+  int                     EventFd;      /*!< tx notify / wake / stop*/
+  _Atomic(bool)           Running;
+
+  uint64_t                LastActive;   /*!< ns of last activity*/
+  uint32_t                SleepUs;      /*!< current back-off*/
+
+  sInterfaceRunnerStats_t stats;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Runner_Private_Functions Interface runner private functions
+  * @{
+  */
+  static inline uint64_t  _this_now(clockid_t clk);
+  static void             _this_notify(void* parent);
+  static bool             _this_wait(InterfaceRunner_t* cthis);
+/** @}*/
+
+
+/**
+ * @brief InterfaceRunner Class constructor
+ *
+ * @param iface pointer to @ref InterfaceHandel_t in process mode
+ * @param cfg   pointer to @ref sInterfaceRunnerCfg_t
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceRunner_t* InterfaceRunner_ctor(InterfaceHandel_t* iface,const sInterfaceRunnerCfg_t* cfg)
+{
+  if((iface == NULL)||(cfg == NULL)||(cfg->SleepMinUs == 0)||(cfg->SleepMaxUs < cfg->SleepMinUs))
+    return NULL;
+
+  InterfaceRunner_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceRunner_t)) == NULL)
+    return NULL;
+
+  if((cthis->EventFd = eventfd(0,EFD_NONBLOCK|EFD_CLOEXEC)) < 0)
+  {
+    heap_free(cthis);
+    return NULL;
+  }
+
+  cthis->iface      = iface;
+  cthis->cfg        = *cfg;
+  cthis->LastActive = _this_now(CLOCK_MONOTONIC);
+  cthis->SleepUs    = cfg->SleepMinUs;
+  atomic_init(&cthis->Running,false);
+  memset(&cthis->stats,0,sizeof(cthis->stats));
+
+  sInterfaceNotify_t notify = {.parent = cthis,.func = _this_notify};
+  Interface_SetTxNotify(iface,&notify);
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceRunner class destructor
+ *
+ * @param cthis pointer to @ref InterfaceRunner_t
+ */
+void InterfaceRunner_dtor(InterfaceRunner_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  Interface_SetTxNotify(cthis->iface,NULL);
+  close(cthis->EventFd);
+  heap_free(cthis);
+}
+
+/**
+ * @brief One runner iteration: poll interface, then spin or sleep
+ *
+ * @param cthis pointer to @ref InterfaceRunner_t
+ * @return true   if interface was active
+ * @return false  idle
+ */
+bool InterfaceRunner_Step(InterfaceRunner_t* cthis)
+{
+  cthis->stats.Polls++;
+
+  if(Interface_poll(cthis->iface))
+  {
+    cthis->stats.Active++;
+    cthis->LastActive = _this_now(CLOCK_MONOTONIC);
+    cthis->SleepUs    = cthis->cfg.SleepMinUs;
+    return true;
+  }
+
+  if((_this_now(CLOCK_MONOTONIC)-cthis->LastActive) < (uint64_t)cthis->cfg.SpinUs*1000u)
+    return false; /* busy-poll window*/
+
+  if(_this_wait(cthis))
+  {
+    cthis->stats.Wakeups++;
+    cthis->SleepUs = cthis->cfg.SleepMinUs;
+  }
+  else if(cthis->SleepUs < cthis->cfg.SleepMaxUs)
+  {
+    cthis->SleepUs = (cthis->SleepUs > cthis->cfg.SleepMaxUs/2) ? cthis->cfg.SleepMaxUs : 2*cthis->SleepUs;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Run loop until @ref InterfaceRunner_Stop
+ *
+ * @param cthis pointer to @ref InterfaceRunner_t
+ */
+void InterfaceRunner_Run(InterfaceRunner_t* cthis)
+{
+  uint64_t wall = _this_now(CLOCK_MONOTONIC);
+  uint64_t cpu  = _this_now(CLOCK_THREAD_CPUTIME_ID);
+
+  atomic_store_explicit(&cthis->Running,true,memory_order_relaxed);
+  cthis->LastActive = wall;
+
+  while(atomic_load_explicit(&cthis->Running,memory_order_relaxed))
+    InterfaceRunner_Step(cthis);
+
+  cthis->stats.RunNs += _this_now(CLOCK_MONOTONIC)-wall;
+  cthis->stats.CpuNs += _this_now(CLOCK_THREAD_CPUTIME_ID)-cpu;
+}
+
+/**
+ * @brief Stop @ref InterfaceRunner_Run (any thread)
+ *
+ * @param cthis pointer to @ref InterfaceRunner_t
+ */
+void InterfaceRunner_Stop(InterfaceRunner_t* cthis)
+{
+  atomic_store_explicit(&cthis->Running,false,memory_order_relaxed);
+  InterfaceRunner_Wake(cthis);
+}
+
+/**
+ * @brief Wake sleeping runner (any thread, signal handler)
+ *
+ * @param cthis pointer to @ref InterfaceRunner_t
+ */
+void InterfaceRunner_Wake(InterfaceRunner_t* cthis)
+{
+  uint64_t one = 1;
+
+  (void)!write(cthis->EventFd,&one,sizeof(one));
+}
+
+/**
+ * @brief Get runner statistic
+ *
+ * @param[in]  cthis pointer to @ref InterfaceRunner_t
+ * @param[out] stats pointer to @ref sInterfaceRunnerStats_t
+ */
+void InterfaceRunner_GetStats(InterfaceRunner_t* cthis,sInterfaceRunnerStats_t* stats)
+{
+  *stats = cthis->stats;
+}
+
+/**
+ * @brief Get clock in ns
+ *
+ * @param clk clock id
+ * @return uint64_t ns
+ */
+static inline uint64_t _this_now(clockid_t clk)
+{
+  struct timespec ts;
+
+  clock_gettime(clk,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Interface tx notify, frame queued
+ *
+ * @param parent pointer to @ref InterfaceRunner_t
+ */
+static void _this_notify(void* parent)
+{
+  InterfaceRunner_Wake((InterfaceRunner_t*)parent);
+}
+
+/**
+ * @brief Sleep up to SleepUs on eventfd and driver fd
+ * @note  eventfd counter keeps notify sent between poll and wait, no lost wake-up
+ * @param cthis pointer to @ref InterfaceRunner_t
+ * @return true   if woken by fd or notify
+ * @return false  timeout
+ */
+static bool _this_wait(InterfaceRunner_t* cthis)
+{
+  struct pollfd fds[2] = {
+    {.fd = cthis->EventFd,    .events = POLLIN},
+    {.fd = cthis->cfg.WaitFd, .events = POLLIN},
+  };
+  struct timespec tmo = {
+    .tv_sec  = cthis->SleepUs/1000000u,
+    .tv_nsec = (long)(cthis->SleepUs%1000000u)*1000,
+  };
+  nfds_t   nfds = (cthis->cfg.WaitFd >= 0) ? 2 : 1;
+  uint64_t t0   = _this_now(CLOCK_MONOTONIC);
+
+  cthis->stats.Sleeps++;
+  int ret = ppoll(fds,nfds,&tmo,NULL);
+  cthis->stats.SleepNs += _this_now(CLOCK_MONOTONIC)-t0;
+
+  if(ret <= 0)
+    return false;
+
+  if(fds[0].revents & POLLIN)
+  {
+    uint64_t cnt;
+    (void)!read(cthis->EventFd,&cnt,sizeof(cnt));
+  }
+
+  return true;
+}
+
+/** @}*/
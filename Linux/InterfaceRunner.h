@@ -0,0 +1,91 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceRunner.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceRunner.c (Linux adaptive process runner)
+  * @version  V1.0.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_RUNNER_H__
+#define __INTERFACE_RUNNER_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Interface.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Runner Interface Linux runner
+ * @brief    Hybrid busy-poll / sleep loop for kInterfaceRxTx_process
+ * @details  After activity the runner busy-polls @ref Interface_poll for SpinUs,
+ *           then sleeps with exponential back-off from SleepMinUs to SleepMaxUs.
+ *           Sleep ends on timeout, on readable WaitFd (driver rx) or at once when
+ *           a frame is queued by Interface_SendData (eventfd).
+ * @{
+ */
+
+typedef struct InterfaceRunner InterfaceRunner_t;   /*!< Interface runner Class typedef*/
+
+/**
+ * @brief Runner config
+ *
+ */
+typedef struct
+{
+  uint32_t  SpinUs;       /*!< Busy-poll window after last activity, us*/
+  uint32_t  SleepMinUs;   /*!< First sleep after spin window, us*/
+  uint32_t  SleepMaxUs;   /*!< Back-off limit, us*/
+  int       WaitFd;       /*!< Driver fd readable on rx data, -1 - timed wait only*/
+}sInterfaceRunnerCfg_t;
+
+/**
+ * @brief Runner statistic
+ *
+ */
+typedef struct
+{
+  uint64_t  Polls;        /*!< Interface_poll calls*/
+  uint64_t  Active;       /*!< Polls with activity*/
+  uint64_t  Sleeps;       /*!< Waits entered*/
+  uint64_t  Wakeups;      /*!< Waits ended by fd or tx notify*/
+  uint64_t  SleepNs;      /*!< Time spent in waits*/
+  uint64_t  RunNs;        /*!< Wall time of InterfaceRunner_Run*/
+  uint64_t  CpuNs;        /*!< Runner thread cpu time of InterfaceRunner_Run*/
+}sInterfaceRunnerStats_t;
+
+/**
+ * @defgroup Interface_Runner_public_func Interface runner public function
+ * @{
+ */
+  InterfaceRunner_t* InterfaceRunner_ctor(InterfaceHandel_t* iface,const sInterfaceRunnerCfg_t* cfg);
+  void               InterfaceRunner_dtor(InterfaceRunner_t* cthis);
+
+  bool               InterfaceRunner_Step(InterfaceRunner_t* cthis);
+  void               InterfaceRunner_Run(InterfaceRunner_t* cthis);
+  void               InterfaceRunner_Stop(InterfaceRunner_t* cthis);
+  void               InterfaceRunner_Wake(InterfaceRunner_t* cthis);
+
+  void               InterfaceRunner_GetStats(InterfaceRunner_t* cthis,sInterfaceRunnerStats_t* stats);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
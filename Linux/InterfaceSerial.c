@@ -0,0 +1,517 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceSerial.c
+ * @author   Wyrm
+ * @brief    Linux termios driver with staging rings
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Open port by InterfaceSerial_ctor(path,cfg) or take an open fd (pty) by
+     InterfaceSerial_ctorFd(), driver owns the fd then
+  2. Create interface on InterfaceSerial_GetHw(), kInterfaceRxTx_process mode,
+     pack algoritm should end frames with cfg.Delim
+  3. Call Interface_process (InterfaceRunner with WaitFd = InterfaceSerial_GetFd())
+  4. With CoalesceTx frames sent outside of the process loop wait for the next
+     poll, call InterfaceSerial_Flush() to push them at once
+  @note driver is not thread safe, use it from the process loop thread
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <linux/serial.h>
+
+#include "wheap.h"
+
+#include "InterfaceSerial.h"
+
+
+/**
+ * @addtogroup Interface_Serial
+ * @{
+ */
+
+/**
+ * @brief Byte ring, Head/Tail are free running
+ *
+ */
+typedef struct
+{
+  uint8_t*  Data;
+  size_t    Mask;
+  size_t    Head;     /*!< read position*/
+  size_t    Tail;     /*!< write position*/
+}sSerialRing_t;
+
+/**
+ * @brief InterfaceSerial Class
+ *
+ */
+struct InterfaceSerial
+{
+  HWInterface_t           base;     /*!< must be first*/
+  HwInterface_vtable_t    vtable;
+
+  int                     fd;
+  sInterfaceSerialCfg_t   cfg;
+  sSerialRing_t           rx;
+  sSerialRing_t           tx;
+  size_t                  Scan;     /*!< rx bytes already searched for Delim*/
+
+  sInterfaceSerialStats_t stats;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Serial_Private_Functions Interface termios driver private functions
+  * @{
+  */
+  static bool   _this_setup(InterfaceSerial_t* cthis);
+  static speed_t _this_speed(uint32_t baud);
+  static inline size_t _this_used(const sSerialRing_t* ring);
+  static int    _this_iov(sSerialRing_t* ring,struct iovec* iov,size_t pos,size_t len);
+  static bool   _this_fill(InterfaceSerial_t* cthis);
+  static size_t _this_frame(InterfaceSerial_t* cthis,size_t max_len);
+  static void   _this_set_buff(void* hw,uint8_t* data,size_t len);
+  static void   _this_nop(void* hw);
+  static bool   _this_true(void* hw);
+  static void   _this_process(void* hw);
+  static bool   _this_is_free(void* hw);
+  static bool   _this_send(void* hw,const uint8_t* data,size_t len);
+  static bool   _this_read(void* hw,uint8_t* data,size_t* len,size_t max_len);
+  static size_t _this_max(void* hw);
+/** @}*/
+
+
+/**
+ * @brief InterfaceSerial Class constructor, opens tty
+ *
+ * @param path  tty device
+ * @param cfg   pointer to @ref sInterfaceSerialCfg_t
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceSerial_t* InterfaceSerial_ctor(const char* path,const sInterfaceSerialCfg_t* cfg)
+{
+  if(path == NULL)
+    return NULL;
+
+  int fd = open(path,O_RDWR|O_NOCTTY|O_NONBLOCK|O_CLOEXEC);
+
+  if(fd < 0)
+    return NULL;
+
+  InterfaceSerial_t* cthis = InterfaceSerial_ctorFd(fd,cfg);
+
+  if(cthis == NULL)
+    close(fd);
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceSerial Class constructor on open fd, driver owns fd on success
+ *
+ * @param fd    tty or pty fd
+ * @param cfg   pointer to @ref sInterfaceSerialCfg_t
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceSerial_t* InterfaceSerial_ctorFd(int fd,const sInterfaceSerialCfg_t* cfg)
+{
+  if((fd < 0)||(cfg == NULL)||(cfg->MaxFrame == 0)
+   ||(cfg->RxRing < 2*cfg->MaxFrame)||(cfg->RxRing & (cfg->RxRing-1))
+   ||(cfg->TxRing < cfg->MaxFrame)||(cfg->TxRing & (cfg->TxRing-1)))
+    return NULL;
+
+  InterfaceSerial_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceSerial_t)) == NULL)
+    return NULL;
+
+  memset(cthis,0,sizeof(*cthis));
+  cthis->fd      = fd;
+  cthis->cfg     = *cfg;
+  cthis->rx.Mask = cfg->RxRing-1;
+  cthis->tx.Mask = cfg->TxRing-1;
+  cthis->rx.Data = heap_malloc(cfg->RxRing);
+  cthis->tx.Data = heap_malloc(cfg->TxRing);
+
+  if((cthis->rx.Data == NULL)||(cthis->tx.Data == NULL)||!_this_setup(cthis))
+  {
+    cthis->fd = -1; /* caller keeps fd on error*/
+    InterfaceSerial_dtor(cthis);
+    return NULL;
+  }
+
+  cthis->vtable.SetRxBuff       = _this_set_buff;
+  cthis->vtable.SetTxBuff       = _this_set_buff;
+  cthis->vtable.EnterCriticalRx = _this_nop;
+  cthis->vtable.ExitCriticalRx  = _this_nop;
+  cthis->vtable.EnterCriticalTx = _this_nop;
+  cthis->vtable.ExitCriticalTx  = _this_nop;
+  cthis->vtable.Connect         = _this_true;
+  cthis->vtable.Disconnect      = _this_true;
+  cthis->vtable.Process         = _this_process;
+  cthis->vtable.IsFree          = _this_is_free;
+  cthis->vtable.SendData        = _this_send;
+  cthis->vtable.ReadRxBuff      = _this_read;
+  cthis->vtable.GetMaxDataLeng  = _this_max;
+  cthis->base.vtable            = &cthis->vtable;
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceSerial class destructor, flushes tx and closes fd
+ *
+ * @param cthis pointer to @ref InterfaceSerial_t
+ */
+void InterfaceSerial_dtor(InterfaceSerial_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  if(cthis->fd >= 0)
+  {
+    InterfaceSerial_Flush(cthis);
+    close(cthis->fd);
+  }
+  heap_free(cthis->rx.Data);
+  heap_free(cthis->tx.Data);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Get driver for @ref Interface_ctor
+ *
+ * @param cthis pointer to @ref InterfaceSerial_t
+ * @return HWInterface_t* driver
+ */
+HWInterface_t* InterfaceSerial_GetHw(InterfaceSerial_t* cthis) {return &cthis->base;}
+
+/**
+ * @brief Get fd, e.g. for @ref sInterfaceRunnerCfg_t WaitFd
+ *
+ * @param cthis pointer to @ref InterfaceSerial_t
+ * @return int fd
+ */
+int InterfaceSerial_GetFd(InterfaceSerial_t* cthis) {return cthis->fd;}
+
+/**
+ * @brief Write queued tx bytes by one writev (non-blocking)
+ *
+ * @param cthis pointer to @ref InterfaceSerial_t
+ * @return true   if tx ring is empty now
+ * @return false  bytes left (tty buffer full) or write error
+ */
+bool InterfaceSerial_Flush(InterfaceSerial_t* cthis)
+{
+  size_t used = _this_used(&cthis->tx);
+
+  if(used == 0)
+    return true;
+
+  struct iovec iov[2];
+  int          cnt = _this_iov(&cthis->tx,iov,cthis->tx.Head,used);
+  ssize_t      ret;
+
+  cthis->stats.TxSyscalls++;
+  while(((ret = writev(cthis->fd,iov,cnt)) < 0)&&(errno == EINTR));
+
+  if(ret <= 0)
+  {
+    if((ret < 0)&&(errno == EAGAIN))
+      cthis->stats.TxAgain++;
+    return false;
+  }
+
+  cthis->tx.Head += (size_t)ret;
+  cthis->stats.TxBytes += (size_t)ret;
+
+  if((size_t)ret < used)
+  {
+    cthis->stats.TxAgain++;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Get driver statistic
+ *
+ * @param[in]  cthis pointer to @ref InterfaceSerial_t
+ * @param[out] stats pointer to @ref sInterfaceSerialStats_t
+ */
+void InterfaceSerial_GetStats(InterfaceSerial_t* cthis,sInterfaceSerialStats_t* stats) {*stats = cthis->stats;}
+
+/**
+ * @brief Raw mode, speed, flow control, low latency
+ *
+ * @param cthis pointer to @ref InterfaceSerial_t
+ * @return true   if fd is a tty set up
+ * @return false  not a tty or bad speed
+ */
+static bool _this_setup(InterfaceSerial_t* cthis)
+{
+  struct termios tio;
+
+  if(tcgetattr(cthis->fd,&tio) != 0)
+    return false;
+
+  cfmakeraw(&tio);
+  tio.c_cflag |= CLOCAL|CREAD;
+  if(cthis->cfg.RtsCts)
+    tio.c_cflag |= CRTSCTS;
+  else
+    tio.c_cflag &= ~CRTSCTS;
+  tio.c_cc[VMIN]  = 0;
+  tio.c_cc[VTIME] = 0;
+
+  if(cthis->cfg.Baud != 0)
+  {
+    speed_t speed = _this_speed(cthis->cfg.Baud);
+
+    if((speed == B0)||(cfsetispeed(&tio,speed) != 0)||(cfsetospeed(&tio,speed) != 0))
+      return false;
+  }
+
+  if(tcsetattr(cthis->fd,TCSANOW,&tio) != 0)
+    return false;
+
+  if(cthis->cfg.LowLatency)
+  {
+    struct serial_struct ser;
+
+    if(ioctl(cthis->fd,TIOCGSERIAL,&ser) == 0)
+    {
+      ser.flags |= ASYNC_LOW_LATENCY;
+      (void)ioctl(cthis->fd,TIOCSSERIAL,&ser); /* not supported by every driver*/
+    }
+  }
+
+  return fcntl(cthis->fd,F_SETFL,fcntl(cthis->fd,F_GETFL)|O_NONBLOCK) == 0;
+}
+
+/**
+ * @brief Baud rate to termios speed
+ *
+ * @param baud baud rate
+ * @return speed_t speed, B0 if not supported
+ */
+static speed_t _this_speed(uint32_t baud)
+{
+  static const struct {uint32_t baud; speed_t speed;} table[] = {
+    {9600,B9600},{19200,B19200},{38400,B38400},{57600,B57600},{115200,B115200},
+    {230400,B230400},{460800,B460800},{500000,B500000},{921600,B921600},
+    {1000000,B1000000},{2000000,B2000000},{3000000,B3000000},{4000000,B4000000},
+  };
+
+  for(size_t i = 0; i < sizeof(table)/sizeof(table[0]); i++)
+    if(table[i].baud == baud)
+      return table[i].speed;
+
+  return B0;
+}
+
+/**
+ * @brief Bytes in ring
+ *
+ */
+static inline size_t _this_used(const sSerialRing_t* ring) {return ring->Tail-ring->Head;}
+
+/**
+ * @brief Ring area as up to two iovecs
+ *
+ * @param ring  pointer to ring
+ * @param iov   output, 2 entries
+ * @param pos   free running start
+ * @param len   area leng
+ * @return int number of iovecs
+ */
+static int _this_iov(sSerialRing_t* ring,struct iovec* iov,size_t pos,size_t len)
+{
+  size_t off   = pos & ring->Mask;
+  size_t first = ring->Mask+1-off;
+
+  iov[0].iov_base = ring->Data+off;
+  if(len <= first)
+  {
+    iov[0].iov_len = len;
+    return 1;
+  }
+  iov[0].iov_len  = first;
+  iov[1].iov_base = ring->Data;
+  iov[1].iov_len  = len-first;
+  return 2;
+}
+
+/**
+ * @brief Fill rx ring by one readv
+ *
+ * @param cthis pointer to @ref InterfaceSerial_t
+ * @return true   if bytes read
+ * @return false  nothing (EAGAIN), ring full or error
+ */
+static bool _this_fill(InterfaceSerial_t* cthis)
+{
+  size_t space = cthis->rx.Mask+1-_this_used(&cthis->rx);
+
+  if(space == 0)
+    return false;
+
+  struct iovec iov[2];
+  int          cnt = _this_iov(&cthis->rx,iov,cthis->rx.Tail,space);
+  ssize_t      ret;
+
+  cthis->stats.RxSyscalls++;
+  while(((ret = readv(cthis->fd,iov,cnt)) < 0)&&(errno == EINTR));
+
+  if(ret <= 0)
+    return false;
+
+  cthis->rx.Tail += (size_t)ret;
+  cthis->stats.RxBytes += (size_t)ret;
+  return true;
+}
+
+/**
+ * @brief Find next frame in rx ring
+ *
+ * @param cthis   pointer to @ref InterfaceSerial_t
+ * @param max_len caller buffer size
+ * @return size_t frame leng from rx.Head, 0 - no complete frame
+ */
+static size_t _this_frame(InterfaceSerial_t* cthis,size_t max_len)
+{
+  sSerialRing_t* rx    = &cthis->rx;
+  size_t         used  = _this_used(rx);
+  size_t         limit = (max_len < cthis->cfg.MaxFrame) ? max_len : cthis->cfg.MaxFrame;
+
+  if(cthis->cfg.Delim < 0)
+    return (used < limit) ? used : limit;
+
+  for(;;)
+  {
+    size_t end = (used < limit) ? used : limit;
+
+    for(; cthis->Scan < end; cthis->Scan++)
+      if(rx->Data[(rx->Head+cthis->Scan) & rx->Mask] == (uint8_t)cthis->cfg.Delim)
+        return ++cthis->Scan;
+
+    if(cthis->Scan < limit)
+      return 0; /* wait for more bytes*/
+
+    /* no delimiter within max frame, resync*/
+    rx->Head += limit;
+    used     -= limit;
+    cthis->stats.RxOverrun += limit;
+    cthis->Scan = 0;
+  }
+}
+
+static void _this_set_buff(void* hw,uint8_t* data,size_t len) {(void)hw;(void)data;(void)len;}
+static void _this_nop(void* hw)                                {(void)hw;}
+static bool _this_true(void* hw)                               {(void)hw;return true;}
+
+/**
+ * @brief Driver process, pushes pending tx
+ *
+ */
+static void _this_process(void* hw) {InterfaceSerial_Flush((InterfaceSerial_t*)hw);}
+
+/**
+ * @brief Driver is free if tx ring holds one more max frame
+ *
+ */
+static bool _this_is_free(void* hw)
+{
+  InterfaceSerial_t* cthis = hw;
+
+  return cthis->tx.Mask+1-_this_used(&cthis->tx) >= cthis->cfg.MaxFrame;
+}
+
+/**
+ * @brief Driver send, frame copied to tx ring
+ *
+ */
+static bool _this_send(void* hw,const uint8_t* data,size_t len)
+{
+  InterfaceSerial_t* cthis = hw;
+  sSerialRing_t*     tx    = &cthis->tx;
+  bool               idle  = (_this_used(tx) == 0);
+
+  if(tx->Mask+1-_this_used(tx) < len)
+  {
+    InterfaceSerial_Flush(cthis);
+    if(tx->Mask+1-_this_used(tx) < len)
+      return false;
+  }
+
+  struct iovec iov[2];
+  int          cnt = _this_iov(tx,iov,tx->Tail,len);
+
+  memcpy(iov[0].iov_base,data,iov[0].iov_len);
+  if(cnt == 2)
+    memcpy(iov[1].iov_base,data+iov[0].iov_len,iov[1].iov_len);
+  tx->Tail += len;
+  cthis->stats.TxFrames++;
+
+  if(idle && !cthis->cfg.CoalesceTx)
+    InterfaceSerial_Flush(cthis);
+
+  return true;
+}
+
+/**
+ * @brief Driver read, next frame from rx ring
+ *
+ */
+static bool _this_read(void* hw,uint8_t* data,size_t* len,size_t max_len)
+{
+  InterfaceSerial_t* cthis = hw;
+  size_t             leng;
+
+  if(_this_used(&cthis->tx) != 0)
+    InterfaceSerial_Flush(cthis);
+
+  if((leng = _this_frame(cthis,max_len)) == 0)
+  {
+    if(!_this_fill(cthis)||((leng = _this_frame(cthis,max_len)) == 0))
+      return false;
+  }
+
+  struct iovec iov[2];
+  int          cnt = _this_iov(&cthis->rx,iov,cthis->rx.Head,leng);
+
+  memcpy(data,iov[0].iov_base,iov[0].iov_len);
+  if(cnt == 2)
+    memcpy(data+iov[0].iov_len,iov[1].iov_base,iov[1].iov_len);
+
+  cthis->rx.Head += leng;
+  cthis->Scan     = 0;
+  *len            = leng;
+  cthis->stats.RxFrames++;
+
+  return true;
+}
+
+/**
+ * @brief Driver max frame
+ *
+ */
+static size_t _this_max(void* hw) {return ((InterfaceSerial_t*)hw)->cfg.MaxFrame;}
+
+/** @}*/
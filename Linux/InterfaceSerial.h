@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceSerial.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceSerial.c (Linux termios driver)
+  * @version  V1.0.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_SERIAL_H__
+#define __INTERFACE_SERIAL_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Interface.h"
+#include "InterfacePrivate.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Serial Interface Linux termios driver
+ * @brief    @ref HWInterface_t over a tty/pty file descriptor
+ * @details  Fd is non-blocking. Rx: one big readv() fills a staging ring, frames are
+ *           handed out of the ring without more syscalls. Tx: frames are copied to a
+ *           tx ring, everything queued goes out by one writev(). Without CoalesceTx
+ *           SendData writes at once when nothing is pending, with CoalesceTx frames
+ *           wait for the next ReadRxBuff (one Interface_process) or InterfaceSerial_Flush.
+ * @{
+ */
+
+typedef struct InterfaceSerial InterfaceSerial_t;   /*!< Interface termios driver Class typedef*/
+
+/**
+ * @brief Serial driver config
+ *
+ */
+typedef struct
+{
+  uint32_t  Baud;         /*!< Line speed, 0 - keep current (pty)*/
+  bool      RtsCts;       /*!< Hardware flow control*/
+  bool      LowLatency;   /*!< ASYNC_LOW_LATENCY (no tty flip buffer delay), ignored if not supported*/
+  int       Delim;        /*!< Frame end byte (kept in frame), -1 - hand out what is read*/
+  size_t    MaxFrame;     /*!< Max frame, GetMaxDataLeng*/
+  size_t    RxRing;       /*!< Rx staging ring size, power of two, >= 2 x MaxFrame*/
+  size_t    TxRing;       /*!< Tx ring size, power of two, >= MaxFrame*/
+  bool      CoalesceTx;   /*!< Do not write from SendData, flush on poll*/
+}sInterfaceSerialCfg_t;
+
+/**
+ * @brief Serial driver statistic
+ *
+ */
+typedef struct
+{
+  uint64_t  RxSyscalls;   /*!< read/readv calls*/
+  uint64_t  TxSyscalls;   /*!< write/writev calls*/
+  uint64_t  RxFrames;
+  uint64_t  TxFrames;
+  uint64_t  RxBytes;
+  uint64_t  TxBytes;
+  uint64_t  RxOverrun;    /*!< Bytes dropped, no delimiter within MaxFrame*/
+  uint64_t  TxAgain;      /*!< Writes cut short by full tty buffer*/
+}sInterfaceSerialStats_t;
+
+/**
+ * @defgroup Interface_Serial_public_func Interface termios driver public function
+ * @{
+ */
+  InterfaceSerial_t*  InterfaceSerial_ctor(const char* path,const sInterfaceSerialCfg_t* cfg);
+  InterfaceSerial_t*  InterfaceSerial_ctorFd(int fd,const sInterfaceSerialCfg_t* cfg);
+  void                InterfaceSerial_dtor(InterfaceSerial_t* cthis);
+
+  HWInterface_t*      InterfaceSerial_GetHw(InterfaceSerial_t* cthis);
+  int                 InterfaceSerial_GetFd(InterfaceSerial_t* cthis);
+  bool                InterfaceSerial_Flush(InterfaceSerial_t* cthis);
+  void                InterfaceSerial_GetStats(InterfaceSerial_t* cthis,sInterfaceSerialStats_t* stats);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
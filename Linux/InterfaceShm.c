@@ -0,0 +1,679 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceShm.c
+ * @author   Wyrm
+ * @brief    Linux shared memory transport, memfd SPSC rings with eventfd wake-up
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Process A creates transport by InterfaceShm_ctor(cfg)
+  2. Process B gets the fds:
+     - fork: InterfaceShm_GetFds() in A before fork, InterfaceShm_ctorPeer() in B
+     - unix socket: InterfaceShm_SendFds(shm,sock) in A, InterfaceShm_ctorRecv(sock) in B
+  3. Both sides create interface on InterfaceShm_GetHw(), kInterfaceRxTx_process
+     mode, and poll it (InterfaceRunner with WaitFd = InterfaceShm_GetWaitFd(),
+     SpinUs long enough for IdlePolls empty polls)
+  4. Zero copy without interface: InterfaceShm_Reserve() / InterfaceShm_Commit()
+     on tx, InterfaceShm_Peek() / InterfaceShm_Release() on rx, use either this
+     or the interface on one side, not both
+  @note one producer and one consumer per direction, each side from one thread
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <string.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+
+#include "wheap.h"
+
+#include "InterfaceShm.h"
+
+
+/**
+ * @addtogroup Interface_Shm
+ * @{
+ */
+
+/* Private define ------------------------------------------------------------*/
+#define SHM_MAGIC         0x4D485349u   /*!< "ISHM"*/
+#define SHM_VERSION       1u
+#define SHM_LINE          64u           /*!< cache line*/
+#define SHM_ALIGN(x)      (((x)+SHM_LINE-1u) & ~(size_t)(SHM_LINE-1u))
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Shared region header
+ *
+ */
+typedef struct
+{
+  uint32_t  Magic;
+  uint32_t  Version;
+  uint32_t  SlotSize;
+  uint32_t  Deep;
+  uint32_t  Stride;       /*!< slot stride, leng word + SlotSize, line aligned*/
+}sShmHeader_t;
+
+/**
+ * @brief SPSC ring control, producer and consumer indexes on own lines
+ *
+ */
+typedef struct
+{
+  _Alignas(SHM_LINE) _Atomic(uint32_t) Tail;    /*!< producer, free running*/
+  _Alignas(SHM_LINE) _Atomic(uint32_t) Head;    /*!< consumer, free running*/
+  _Alignas(SHM_LINE) _Atomic(uint32_t) Waiting; /*!< consumer sleeps, wake by eventfd*/
+}sShmRing_t;
+
+/**
+ * @brief InterfaceShm Class
+ *
+ */
+struct InterfaceShm
+{
+  HWInterface_t         base;       /*!< must be first*/
+  HwInterface_vtable_t  vtable;
+
+  int                   fds[INTERFACE_SHM_FDS];
+  bool                  SideB;
+  uint8_t*              Map;
+  size_t                MapSize;
+
+  sShmRing_t*           Tx;
+  sShmRing_t*           Rx;
+  uint8_t*              TxSlots;
+  uint8_t*              RxSlots;
+  int                   EvTx;       /*!< wakes peer*/
+  int                   EvRx;       /*!< wakes us*/
+  uint32_t              Mask;
+  uint32_t              Stride;
+  size_t                SlotSize;
+
+  uint32_t              TxHeadCache;
+  uint32_t              RxTailCache;
+  uint32_t              IdlePolls;
+  uint32_t              Idle;
+  bool                  Armed;
+
+  sInterfaceShmStats_t  stats;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Shm_Private_Functions Interface shared memory transport private functions
+  * @{
+  */
+  static InterfaceShm_t* _this_create(const int fds[INTERFACE_SHM_FDS],bool SideB,uint32_t IdlePolls);
+  static inline size_t   _this_map_size(uint32_t Deep,uint32_t Stride);
+  static inline uint8_t* _this_slot(InterfaceShm_t* cthis,uint8_t* slots,uint32_t pos);
+  static bool            _this_tx_full(InterfaceShm_t* cthis);
+  static void            _this_publish(InterfaceShm_t* cthis);
+  static bool            _this_rx_empty(InterfaceShm_t* cthis);
+  static void            _this_arm(InterfaceShm_t* cthis);
+  static void            _this_unarm(InterfaceShm_t* cthis);
+  static void            _this_set_buff(void* hw,uint8_t* data,size_t len);
+  static void            _this_nop(void* hw);
+  static bool            _this_true(void* hw);
+  static bool            _this_is_free(void* hw);
+  static bool            _this_send(void* hw,const uint8_t* data,size_t len);
+  static bool            _this_read(void* hw,uint8_t* data,size_t* len,size_t max_len);
+  static size_t          _this_max(void* hw);
+/** @}*/
+
+
+/**
+ * @brief InterfaceShm Class constructor, creates memfd and eventfds (side A)
+ *
+ * @param cfg pointer to @ref sInterfaceShmCfg_t
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceShm_t* InterfaceShm_ctor(const sInterfaceShmCfg_t* cfg)
+{
+  if((cfg == NULL)||(cfg->SlotSize == 0)||(cfg->SlotSize > UINT32_MAX/2)
+   ||(cfg->Deep == 0)||(cfg->Deep > (1u << 30)))
+    return NULL;
+
+  uint32_t deep = 1;
+  while(deep < cfg->Deep)
+    deep <<= 1;
+
+  uint32_t stride = (uint32_t)SHM_ALIGN(sizeof(uint32_t)+cfg->SlotSize);
+  size_t   size   = _this_map_size(deep,stride);
+  int      fds[INTERFACE_SHM_FDS] = {-1,-1,-1};
+
+  fds[0] = memfd_create("interface_shm",MFD_CLOEXEC|MFD_ALLOW_SEALING);
+  fds[1] = eventfd(0,EFD_NONBLOCK|EFD_CLOEXEC);
+  fds[2] = eventfd(0,EFD_NONBLOCK|EFD_CLOEXEC);
+
+  if((fds[0] < 0)||(fds[1] < 0)||(fds[2] < 0)||(ftruncate(fds[0],(off_t)size) != 0))
+    goto error;
+
+  /* size is fixed for the peer*/
+  (void)fcntl(fds[0],F_ADD_SEALS,F_SEAL_SHRINK|F_SEAL_GROW|F_SEAL_SEAL);
+
+  sShmHeader_t* hdr = mmap(NULL,sizeof(sShmHeader_t),PROT_READ|PROT_WRITE,MAP_SHARED,fds[0],0);
+
+  if(hdr == MAP_FAILED)
+    goto error;
+
+  hdr->SlotSize = (uint32_t)cfg->SlotSize;
+  hdr->Deep     = deep;
+  hdr->Stride   = stride;
+  hdr->Version  = SHM_VERSION;
+  hdr->Magic    = SHM_MAGIC;
+  munmap(hdr,sizeof(sShmHeader_t));
+
+  InterfaceShm_t* cthis = _this_create(fds,false,cfg->IdlePolls);
+
+  if(cthis != NULL)
+    return cthis;
+
+error:
+  for(unsigned i = 0; i < INTERFACE_SHM_FDS; i++)
+    if(fds[i] >= 0)
+      close(fds[i]);
+  return NULL;
+}
+
+/**
+ * @brief InterfaceShm Class constructor of side B, driver owns fds on success
+ *
+ * @param fds       fds of @ref InterfaceShm_GetFds
+ * @param IdlePolls empty reads before eventfd wake-up is armed
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceShm_t* InterfaceShm_ctorPeer(const int fds[INTERFACE_SHM_FDS],uint32_t IdlePolls)
+{
+  return _this_create(fds,true,IdlePolls);
+}
+
+/**
+ * @brief InterfaceShm Class constructor of side B, fds from unix socket
+ *
+ * @param sock      unix socket, peer called @ref InterfaceShm_SendFds
+ * @param IdlePolls empty reads before eventfd wake-up is armed
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceShm_t* InterfaceShm_ctorRecv(int sock,uint32_t IdlePolls)
+{
+  char          byte;
+  struct iovec  iov = {.iov_base = &byte,.iov_len = 1};
+  union
+  {
+    char            buf[CMSG_SPACE(INTERFACE_SHM_FDS*sizeof(int))];
+    struct cmsghdr  align;
+  }ctrl;
+  struct msghdr msg = {.msg_iov = &iov,.msg_iovlen = 1,.msg_control = ctrl.buf,.msg_controllen = sizeof(ctrl.buf)};
+
+  if(recvmsg(sock,&msg,MSG_CMSG_CLOEXEC) != 1)
+    return NULL;
+
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  int             fds[INTERFACE_SHM_FDS];
+
+  if((cmsg == NULL)||(cmsg->cmsg_level != SOL_SOCKET)||(cmsg->cmsg_type != SCM_RIGHTS))
+    return NULL;
+
+  size_t cnt = (cmsg->cmsg_len-CMSG_LEN(0))/sizeof(int);
+
+  memcpy(fds,CMSG_DATA(cmsg),((cnt < INTERFACE_SHM_FDS) ? cnt : INTERFACE_SHM_FDS)*sizeof(int));
+
+  InterfaceShm_t* cthis = (cnt == INTERFACE_SHM_FDS) ? _this_create(fds,true,IdlePolls) : NULL;
+
+  if(cthis == NULL)
+    for(size_t i = 0; i < cnt && i < INTERFACE_SHM_FDS; i++)
+      close(fds[i]);
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceShm class destructor
+ *
+ * @param cthis pointer to @ref InterfaceShm_t
+ */
+void InterfaceShm_dtor(InterfaceShm_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  if(cthis->Map != NULL)
+    munmap(cthis->Map,cthis->MapSize);
+  for(unsigned i = 0; i < INTERFACE_SHM_FDS; i++)
+    if(cthis->fds[i] >= 0)
+      close(cthis->fds[i]);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Pass fds to side B over unix socket (SCM_RIGHTS)
+ *
+ * @param cthis pointer to @ref InterfaceShm_t
+ * @param sock  connected unix socket
+ * @return true   if sent
+ * @return false  error
+ */
+bool InterfaceShm_SendFds(InterfaceShm_t* cthis,int sock)
+{
+  char          byte = 0;
+  struct iovec  iov  = {.iov_base = &byte,.iov_len = 1};
+  union
+  {
+    char            buf[CMSG_SPACE(INTERFACE_SHM_FDS*sizeof(int))];
+    struct cmsghdr  align;
+  }ctrl;
+  struct msghdr msg = {.msg_iov = &iov,.msg_iovlen = 1,.msg_control = ctrl.buf,.msg_controllen = sizeof(ctrl.buf)};
+
+  memset(&ctrl,0,sizeof(ctrl));
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type  = SCM_RIGHTS;
+  cmsg->cmsg_len   = CMSG_LEN(INTERFACE_SHM_FDS*sizeof(int));
+  memcpy(CMSG_DATA(cmsg),cthis->fds,INTERFACE_SHM_FDS*sizeof(int));
+
+  return sendmsg(sock,&msg,0) == 1;
+}
+
+/**
+ * @brief Get fds for @ref InterfaceShm_ctorPeer, memfd, eventfd A->B, eventfd B->A
+ *
+ * @param[in]  cthis pointer to @ref InterfaceShm_t
+ * @param[out] fds   fds
+ */
+void InterfaceShm_GetFds(InterfaceShm_t* cthis,int fds[INTERFACE_SHM_FDS])
+{
+  memcpy(fds,cthis->fds,sizeof(cthis->fds));
+}
+
+/**
+ * @brief Get driver for @ref Interface_ctor
+ *
+ * @param cthis pointer to @ref InterfaceShm_t
+ * @return HWInterface_t* driver
+ */
+HWInterface_t* InterfaceShm_GetHw(InterfaceShm_t* cthis) {return &cthis->base;}
+
+/**
+ * @brief Get rx eventfd, readable when peer woke us, e.g. for @ref sInterfaceRunnerCfg_t WaitFd
+ *
+ * @param cthis pointer to @ref InterfaceShm_t
+ * @return int eventfd
+ */
+int InterfaceShm_GetWaitFd(InterfaceShm_t* cthis) {return cthis->EvRx;}
+
+/**
+ * @brief Block until rx frame or timeout
+ *
+ * @param cthis       pointer to @ref InterfaceShm_t
+ * @param timeout_ms  poll timeout, -1 - infinite
+ * @return true   if frame is waiting
+ * @return false  timeout
+ */
+bool InterfaceShm_Wait(InterfaceShm_t* cthis,int timeout_ms)
+{
+  if(!_this_rx_empty(cthis))
+    return true;
+
+  cthis->Idle = cthis->IdlePolls;
+  _this_arm(cthis);
+
+  if(_this_rx_empty(cthis))
+  {
+    struct pollfd pfd = {.fd = cthis->EvRx,.events = POLLIN};
+    (void)poll(&pfd,1,timeout_ms);
+  }
+
+  return !_this_rx_empty(cthis);
+}
+
+/**
+ * @brief Lend next tx slot (zero copy)
+ *
+ * @param cthis pointer to @ref InterfaceShm_t
+ * @return uint8_t* slot memory of SlotSize bytes, NULL if ring is full
+ */
+uint8_t* InterfaceShm_Reserve(InterfaceShm_t* cthis)
+{
+  if(_this_tx_full(cthis))
+    return NULL;
+
+  uint32_t tail = atomic_load_explicit(&cthis->Tx->Tail,memory_order_relaxed);
+
+  return _this_slot(cthis,cthis->TxSlots,tail)+sizeof(uint32_t);
+}
+
+/**
+ * @brief Send lent tx slot, only after successful @ref InterfaceShm_Reserve
+ *
+ * @param cthis pointer to @ref InterfaceShm_t
+ * @param leng  used size of slot
+ */
+void InterfaceShm_Commit(InterfaceShm_t* cthis,size_t leng)
+{
+  uint32_t tail = atomic_load_explicit(&cthis->Tx->Tail,memory_order_relaxed);
+
+  memcpy(_this_slot(cthis,cthis->TxSlots,tail),&(uint32_t){(uint32_t)leng},sizeof(uint32_t));
+  _this_publish(cthis);
+}
+
+/**
+ * @brief Lend next rx slot (zero copy)
+ *
+ * @param[in]  cthis pointer to @ref InterfaceShm_t
+ * @param[out] leng  frame leng
+ * @return const uint8_t* frame, NULL if ring is empty
+ */
+const uint8_t* InterfaceShm_Peek(InterfaceShm_t* cthis,size_t* leng)
+{
+  if(_this_rx_empty(cthis))
+    return NULL;
+
+  uint8_t* slot = _this_slot(cthis,cthis->RxSlots,atomic_load_explicit(&cthis->Rx->Head,memory_order_relaxed));
+  uint32_t len;
+
+  memcpy(&len,slot,sizeof(len));
+  *leng = (len <= cthis->SlotSize) ? len : cthis->SlotSize;
+  return slot+sizeof(uint32_t);
+}
+
+/**
+ * @brief Return lent rx slot, only after successful @ref InterfaceShm_Peek
+ *
+ * @param cthis pointer to @ref InterfaceShm_t
+ */
+void InterfaceShm_Release(InterfaceShm_t* cthis)
+{
+  uint32_t head = atomic_load_explicit(&cthis->Rx->Head,memory_order_relaxed);
+
+  atomic_store_explicit(&cthis->Rx->Head,head+1u,memory_order_release);
+  cthis->stats.RxFrames++;
+}
+
+/**
+ * @brief Get transport statistic
+ *
+ * @param[in]  cthis pointer to @ref InterfaceShm_t
+ * @param[out] stats pointer to @ref sInterfaceShmStats_t
+ */
+void InterfaceShm_GetStats(InterfaceShm_t* cthis,sInterfaceShmStats_t* stats) {*stats = cthis->stats;}
+
+/**
+ * @brief Map memfd and set up one side
+ *
+ * @param fds       memfd, eventfd A->B, eventfd B->A
+ * @param SideB     false - creator
+ * @param IdlePolls empty reads before eventfd wake-up is armed
+ * @return pointer to allocated class, NULL if error
+ */
+static InterfaceShm_t* _this_create(const int fds[INTERFACE_SHM_FDS],bool SideB,uint32_t IdlePolls)
+{
+  struct stat   st;
+  sShmHeader_t  hdr;
+
+  if((fstat(fds[0],&st) != 0)||((size_t)st.st_size < sizeof(hdr))
+   ||(pread(fds[0],&hdr,sizeof(hdr),0) != (ssize_t)sizeof(hdr)))
+    return NULL;
+
+  if((hdr.Magic != SHM_MAGIC)||(hdr.Version != SHM_VERSION)||(hdr.Deep == 0)
+   ||(hdr.Deep & (hdr.Deep-1u))||(hdr.Stride < sizeof(uint32_t)+hdr.SlotSize)
+   ||((size_t)st.st_size < _this_map_size(hdr.Deep,hdr.Stride)))
+    return NULL;
+
+  InterfaceShm_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceShm_t)) == NULL)
+    return NULL;
+
+  memset(cthis,0,sizeof(*cthis));
+  cthis->MapSize = _this_map_size(hdr.Deep,hdr.Stride);
+  cthis->Map     = mmap(NULL,cthis->MapSize,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_POPULATE,fds[0],0);
+
+  if(cthis->Map == MAP_FAILED)
+  {
+    heap_free(cthis);
+    return NULL;
+  }
+
+  memcpy(cthis->fds,fds,sizeof(cthis->fds));
+  cthis->SideB     = SideB;
+  cthis->Mask      = hdr.Deep-1u;
+  cthis->Stride    = hdr.Stride;
+  cthis->SlotSize  = hdr.SlotSize;
+  cthis->IdlePolls = IdlePolls;
+
+  sShmRing_t* ring   = (sShmRing_t*)(cthis->Map+SHM_ALIGN(sizeof(sShmHeader_t)));
+  uint8_t*    slots0 = (uint8_t*)&ring[2];
+  uint8_t*    slots1 = slots0+(size_t)hdr.Deep*hdr.Stride;
+
+  /* ring 0: A->B, ring 1: B->A*/
+  cthis->Tx      = SideB ? &ring[1] : &ring[0];
+  cthis->Rx      = SideB ? &ring[0] : &ring[1];
+  cthis->TxSlots = SideB ? slots1   : slots0;
+  cthis->RxSlots = SideB ? slots0   : slots1;
+  cthis->EvTx    = SideB ? fds[2]   : fds[1];
+  cthis->EvRx    = SideB ? fds[1]   : fds[2];
+  cthis->TxHeadCache = atomic_load_explicit(&cthis->Tx->Head,memory_order_acquire);
+  cthis->RxTailCache = atomic_load_explicit(&cthis->Rx->Tail,memory_order_acquire);
+
+  cthis->vtable.SetRxBuff       = _this_set_buff;
+  cthis->vtable.SetTxBuff       = _this_set_buff;
+  cthis->vtable.EnterCriticalRx = _this_nop;
+  cthis->vtable.ExitCriticalRx  = _this_nop;
+  cthis->vtable.EnterCriticalTx = _this_nop;
+  cthis->vtable.ExitCriticalTx  = _this_nop;
+  cthis->vtable.Connect         = _this_true;
+  cthis->vtable.Disconnect      = _this_true;
+  cthis->vtable.Process         = _this_nop;
+  cthis->vtable.IsFree          = _this_is_free;
+  cthis->vtable.SendData        = _this_send;
+  cthis->vtable.ReadRxBuff      = _this_read;
+  cthis->vtable.GetMaxDataLeng  = _this_max;
+  cthis->base.vtable            = &cthis->vtable;
+
+  return cthis;
+}
+
+/**
+ * @brief Shared region size, header, two rings, two slot arrays
+ *
+ */
+static inline size_t _this_map_size(uint32_t Deep,uint32_t Stride)
+{
+  return SHM_ALIGN(sizeof(sShmHeader_t))+2u*sizeof(sShmRing_t)+2u*(size_t)Deep*Stride;
+}
+
+/**
+ * @brief Slot of free running position
+ *
+ */
+static inline uint8_t* _this_slot(InterfaceShm_t* cthis,uint8_t* slots,uint32_t pos)
+{
+  return slots+(size_t)(pos & cthis->Mask)*cthis->Stride;
+}
+
+/**
+ * @brief Check tx ring is full, consumer index read only when cached one says full
+ *
+ */
+static bool _this_tx_full(InterfaceShm_t* cthis)
+{
+  uint32_t tail = atomic_load_explicit(&cthis->Tx->Tail,memory_order_relaxed);
+
+  if(tail-cthis->TxHeadCache <= cthis->Mask)
+    return false;
+
+  cthis->TxHeadCache = atomic_load_explicit(&cthis->Tx->Head,memory_order_acquire);
+  return tail-cthis->TxHeadCache > cthis->Mask;
+}
+
+/**
+ * @brief Publish filled tx slot, wake peer if it sleeps
+ * @note  Tail store / Waiting load pairs with Waiting store / Tail load of
+ *        @ref _this_arm, both seq_cst, a frame is never left without wake-up
+ */
+static void _this_publish(InterfaceShm_t* cthis)
+{
+  uint32_t tail = atomic_load_explicit(&cthis->Tx->Tail,memory_order_relaxed);
+
+  atomic_store_explicit(&cthis->Tx->Tail,tail+1u,memory_order_seq_cst);
+  cthis->stats.TxFrames++;
+
+  if(atomic_load_explicit(&cthis->Tx->Waiting,memory_order_seq_cst)
+   &&atomic_exchange_explicit(&cthis->Tx->Waiting,0,memory_order_seq_cst))
+  {
+    uint64_t one = 1;
+
+    cthis->stats.Wakes++;
+    (void)!write(cthis->EvTx,&one,sizeof(one));
+  }
+}
+
+/**
+ * @brief Check rx ring is empty, arms wake-up after IdlePolls empty checks
+ *
+ */
+static bool _this_rx_empty(InterfaceShm_t* cthis)
+{
+  uint32_t head = atomic_load_explicit(&cthis->Rx->Head,memory_order_relaxed);
+
+  if(head != cthis->RxTailCache)
+  {
+    _this_unarm(cthis);
+    return false;
+  }
+
+  cthis->RxTailCache = atomic_load_explicit(&cthis->Rx->Tail,memory_order_acquire);
+  if(head != cthis->RxTailCache)
+  {
+    _this_unarm(cthis);
+    return false;
+  }
+
+  if(!cthis->Armed && (++cthis->Idle >= cthis->IdlePolls))
+  {
+    _this_arm(cthis);
+    /* frame may be published before Waiting was seen by producer*/
+    cthis->RxTailCache = atomic_load_explicit(&cthis->Rx->Tail,memory_order_seq_cst);
+    if(head != cthis->RxTailCache)
+    {
+      _this_unarm(cthis);
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Arm eventfd wake-up, stale wake-ups are dropped first
+ *
+ */
+static void _this_arm(InterfaceShm_t* cthis)
+{
+  uint64_t cnt;
+
+  if(cthis->Armed)
+    return;
+
+  (void)!read(cthis->EvRx,&cnt,sizeof(cnt));
+  cthis->Armed = true;
+  cthis->stats.Arms++;
+  atomic_store_explicit(&cthis->Rx->Waiting,1,memory_order_seq_cst);
+}
+
+/**
+ * @brief Disarm wake-up, drain eventfd if producer already fired it
+ *
+ */
+static void _this_unarm(InterfaceShm_t* cthis)
+{
+  cthis->Idle = 0;
+  if(!cthis->Armed)
+    return;
+
+  cthis->Armed = false;
+  if(atomic_exchange_explicit(&cthis->Rx->Waiting,0,memory_order_seq_cst) == 0)
+  {
+    uint64_t cnt;
+    (void)!read(cthis->EvRx,&cnt,sizeof(cnt));
+  }
+}
+
+static void _this_set_buff(void* hw,uint8_t* data,size_t len) {(void)hw;(void)data;(void)len;}
+static void _this_nop(void* hw)                                {(void)hw;}
+static bool _this_true(void* hw)                               {(void)hw;return true;}
+
+/**
+ * @brief Driver is free while tx ring has a slot
+ *
+ */
+static bool _this_is_free(void* hw) {return !_this_tx_full((InterfaceShm_t*)hw);}
+
+/**
+ * @brief Driver send, one copy into tx slot
+ *
+ */
+static bool _this_send(void* hw,const uint8_t* data,size_t len)
+{
+  InterfaceShm_t* cthis = hw;
+  uint8_t*        slot;
+
+  if(len > cthis->SlotSize)
+    return false;
+
+  if((slot = InterfaceShm_Reserve(cthis)) == NULL)
+  {
+    cthis->stats.TxFull++;
+    return false;
+  }
+
+  memcpy(slot,data,len);
+  InterfaceShm_Commit(cthis,len);
+  return true;
+}
+
+/**
+ * @brief Driver read, one copy from rx slot
+ *
+ */
+static bool _this_read(void* hw,uint8_t* data,size_t* len,size_t max_len)
+{
+  InterfaceShm_t* cthis = hw;
+  const uint8_t*  frame;
+  size_t          leng;
+
+  if((frame = InterfaceShm_Peek(cthis,&leng)) == NULL)
+    return false;
+
+  if(leng <= max_len)
+  {
+    memcpy(data,frame,leng);
+    *len = leng;
+  }
+  InterfaceShm_Release(cthis);
+
+  return leng <= max_len;
+}
+
+/**
+ * @brief Driver max frame
+ *
+ */
+static size_t _this_max(void* hw) {return ((InterfaceShm_t*)hw)->SlotSize;}
+
+/** @}*/
@@ -0,0 +1,101 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceShm.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceShm.c (Linux shared memory transport)
+  * @version  V1.0.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_SHM_H__
+#define __INTERFACE_SHM_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Interface.h"
+#include "InterfacePrivate.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Shm Interface Linux shared memory transport
+ * @brief    @ref HWInterface_t between two processes over a memfd
+ * @details  The memfd holds two SPSC slot rings, one per direction. SendData and
+ *           ReadRxBuff are one copy each, InterfaceShm_Reserve/Commit and
+ *           InterfaceShm_Peek/Release lend ring slots for zero copy. A consumer
+ *           idle for IdlePolls reads arms an eventfd wake-up, producers write the
+ *           eventfd only then, the streaming path has no syscalls.
+ * @{
+ */
+
+typedef struct InterfaceShm InterfaceShm_t;   /*!< Interface shared memory transport Class typedef*/
+
+#define INTERFACE_SHM_FDS   3u   /*!< memfd, eventfd A->B, eventfd B->A*/
+
+/**
+ * @brief Shared memory transport config (creating side)
+ *
+ */
+typedef struct
+{
+  size_t    SlotSize;     /*!< Max frame, GetMaxDataLeng*/
+  uint32_t  Deep;         /*!< Slots per direction, rounded up to power of two*/
+  uint32_t  IdlePolls;    /*!< Empty reads before eventfd wake-up is armed, 0 - at once*/
+}sInterfaceShmCfg_t;
+
+/**
+ * @brief Shared memory transport statistic
+ *
+ */
+typedef struct
+{
+  uint64_t  RxFrames;
+  uint64_t  TxFrames;
+  uint64_t  TxFull;       /*!< SendData on full ring*/
+  uint64_t  Wakes;        /*!< eventfd writes to peer*/
+  uint64_t  Arms;         /*!< wake-ups armed by idle rx*/
+}sInterfaceShmStats_t;
+
+/**
+ * @defgroup Interface_Shm_public_func Interface shared memory transport public function
+ * @{
+ */
+  InterfaceShm_t*     InterfaceShm_ctor(const sInterfaceShmCfg_t* cfg);
+  InterfaceShm_t*     InterfaceShm_ctorPeer(const int fds[INTERFACE_SHM_FDS],uint32_t IdlePolls);
+  InterfaceShm_t*     InterfaceShm_ctorRecv(int sock,uint32_t IdlePolls);
+  void                InterfaceShm_dtor(InterfaceShm_t* cthis);
+
+  bool                InterfaceShm_SendFds(InterfaceShm_t* cthis,int sock);
+  void                InterfaceShm_GetFds(InterfaceShm_t* cthis,int fds[INTERFACE_SHM_FDS]);
+  HWInterface_t*      InterfaceShm_GetHw(InterfaceShm_t* cthis);
+  int                 InterfaceShm_GetWaitFd(InterfaceShm_t* cthis);
+  bool                InterfaceShm_Wait(InterfaceShm_t* cthis,int timeout_ms);
+
+  uint8_t*            InterfaceShm_Reserve(InterfaceShm_t* cthis);
+  void                InterfaceShm_Commit(InterfaceShm_t* cthis,size_t leng);
+  const uint8_t*      InterfaceShm_Peek(InterfaceShm_t* cthis,size_t* leng);
+  void                InterfaceShm_Release(InterfaceShm_t* cthis);
+
+  void                InterfaceShm_GetStats(InterfaceShm_t* cthis,sInterfaceShmStats_t* stats);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,741 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceSim.c
+ * @author   Wyrm
+ * @brief    Virtual time link simulator driver
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this class #####
+  ==============================================================================
+  1. Fill sInterfaceSimCfg_t, one sInterfaceSimPathCfg_t per direction, and
+     create the link by InterfaceSim_ctor()
+  2. Create one interface on each end, InterfaceSim_GetHw(sim,0) and (sim,1).
+     Clocks of ARQ, fragmentation or shaper: {.parent = sim,.func = InterfaceSim_Tick},
+     rx time stamps: {.parent = sim,.func = InterfaceSim_Time} (ns, driver
+     reports the frame arrival time)
+  3. Loop:
+     - process mode: Interface_process() of both ends, then
+       InterfaceSim_Advance(sim,quantum), quantum is the longest step the
+       application allows without a poll (timer resolution)
+     - irq mode: InterfaceSim_Advance() delivers chunks and tx complete from
+       inside, as the hardware irq would
+  4. InterfaceSim_GetStats() per direction, InterfaceSim_SetPath() changes
+     conditions on the fly (outage, rate change)
+  @note SendData is refused while the previous frame is on the wire, so the
+        interface queues exactly as with a real UART or radio
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <string.h>
+#include <math.h>
+
+#include "wheap.h"
+
+#include "InterfaceSim.h"
+
+
+/**
+ * @addtogroup Interface_Sim
+ * @{
+ */
+
+/* Private macro -------------------------------------------------------------*/
+#define SIM_NEVER         UINT64_MAX
+#define SIM_DEF_BYTE_BITS 10u
+#define SIM_DEF_TICK_NS   1000000u
+#define SIM_DEF_SEED      0x9E3779B97F4A7C15ull
+#define SIM_MAX_FIRE      64u   /*!< irq rounds per Advance, callbacks may send at the same instant*/
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Frame in flight
+ *
+ */
+typedef struct
+{
+  uint64_t  Arrive;   /*!< Time the last bit reaches the receiver*/
+  size_t    Leng;
+  uint8_t*  Data;     /*!< Own MaxFrame buffer, moves with the entry*/
+}sSimFrame_t;
+
+/**
+ * @brief One direction of the link
+ *
+ */
+typedef struct
+{
+  sInterfaceSimPathCfg_t  cfg;
+  sSimFrame_t*            Fifo;       /*!< Deep entries, sorted by Arrive*/
+  size_t                  Head;
+  size_t                  Count;
+  size_t                  HeadPos;    /*!< Bytes of head frame already read (chunk mode)*/
+  uint64_t                TxBusyUntil;
+  uint64_t                LastArrive; /*!< Arrival of last frame, keeps order without Reorder*/
+  uint64_t                LastRxTs;   /*!< Arrival of last read byte*/
+
+  bool                    InBurst;
+  uint64_t                BitsToErr;  /*!< Clean bits before next error*/
+  uint64_t                BitsToSwitch;/*!< Bits before burst state change*/
+
+  sInterfaceSimStats_t    stats;
+}sSimPath_t;
+
+/**
+ * @brief One end of the link, driver seen by the interface
+ *
+ */
+typedef struct
+{
+  HWInterface_t         base;     /*!< must be first*/
+  HwInterface_vtable_t  vtable;
+  InterfaceSim_t*       sim;
+  size_t                Id;       /*!< transmits on Path[Id], receives on Path[Id^1]*/
+  uint8_t*              RxHw;     /*!< irq mode rx buffer*/
+  size_t                RxHwLen;
+  bool                  TxPending;/*!< tx complete irq not yet raised*/
+}sSimEnd_t;
+
+/**
+ * @brief InterfaceSim Class
+ *
+ */
+struct InterfaceSim
+{
+  sSimEnd_t   End[2];
+  sSimPath_t  Path[2];
+  size_t      MaxFrame;
+  size_t      Deep;
+  uint64_t    TickNs;
+  uint64_t    Now;        /*!< Virtual time, ns*/
+  uint64_t    Rng;
+  uint8_t*    Pool;       /*!< 2 x Deep x MaxFrame*/
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup Interface_Sim_Private_Functions Interface link simulator private functions
+  * @{
+  */
+  static inline uint64_t  _this_rand(InterfaceSim_t* cthis);
+  static inline double    _this_uniform(InterfaceSim_t* cthis);
+  static uint64_t _this_geometric(InterfaceSim_t* cthis,double p);
+  static void     _this_path_reset(InterfaceSim_t* cthis,sSimPath_t* path);
+  static void     _this_corrupt(InterfaceSim_t* cthis,sSimPath_t* path,uint8_t* data,size_t len);
+  static bool     _this_take(InterfaceSim_t* cthis,sSimPath_t* path,uint8_t* dst,size_t* len,size_t max_len);
+  static bool     _this_fire(InterfaceSim_t* cthis);
+  static void     _this_set_rx(void* hw,uint8_t* data,size_t len);
+  static void     _this_set_buff(void* hw,uint8_t* data,size_t len);
+  static void     _this_nop(void* hw);
+  static bool     _this_true(void* hw);
+  static bool     _this_free(void* hw);
+  static bool     _this_send(void* hw,const uint8_t* data,size_t len);
+  static bool     _this_read(void* hw,uint8_t* data,size_t* len,size_t max_len);
+  static size_t   _this_max(void* hw);
+  static bool     _this_rx_ts(void* hw,uint64_t* ts);
+/** @}*/
+
+
+/**
+ * @brief InterfaceSim Class constructor
+ *
+ * @param cfg pointer to @ref sInterfaceSimCfg_t
+ * @return pointer to allocated class, NULL if error
+ */
+InterfaceSim_t* InterfaceSim_ctor(const sInterfaceSimCfg_t* cfg)
+{
+  if((cfg == NULL)||(cfg->MaxFrame == 0)||(cfg->Deep == 0))
+    return NULL;
+
+  InterfaceSim_t* cthis = NULL;
+
+  if((cthis = heap_malloc_cast(InterfaceSim_t)) == NULL)
+    return NULL;
+
+  memset(cthis,0,sizeof(*cthis));
+  cthis->MaxFrame = cfg->MaxFrame;
+  cthis->Deep     = cfg->Deep;
+  cthis->TickNs   = cfg->TickNs ? cfg->TickNs : SIM_DEF_TICK_NS;
+  cthis->Rng      = cfg->Seed ? cfg->Seed : SIM_DEF_SEED;
+  cthis->Pool     = heap_malloc(2*cfg->Deep*cfg->MaxFrame);
+  cthis->Path[0].Fifo = heap_malloc(cfg->Deep*sizeof(sSimFrame_t));
+  cthis->Path[1].Fifo = heap_malloc(cfg->Deep*sizeof(sSimFrame_t));
+
+  if((cthis->Pool == NULL)||(cthis->Path[0].Fifo == NULL)||(cthis->Path[1].Fifo == NULL)
+   ||!InterfaceSim_SetPath(cthis,0,&cfg->Path[0])||!InterfaceSim_SetPath(cthis,1,&cfg->Path[1]))
+  {
+    InterfaceSim_dtor(cthis);
+    return NULL;
+  }
+
+  for(size_t dir = 0; dir < 2; dir++)
+  {
+    sSimEnd_t* end = &cthis->End[dir];
+
+    for(size_t i = 0; i < cfg->Deep; i++)
+      cthis->Path[dir].Fifo[i].Data = &cthis->Pool[(dir*cfg->Deep+i)*cfg->MaxFrame];
+
+    end->vtable.SetRxBuff       = _this_set_rx;
+    end->vtable.SetTxBuff       = _this_set_buff;
+    end->vtable.EnterCriticalRx = _this_nop;
+    end->vtable.ExitCriticalRx  = _this_nop;
+    end->vtable.EnterCriticalTx = _this_nop;
+    end->vtable.ExitCriticalTx  = _this_nop;
+    end->vtable.Connect         = _this_true;
+    end->vtable.Disconnect      = _this_true;
+    end->vtable.Process         = _this_nop;
+    end->vtable.IsFree          = _this_free;
+    end->vtable.SendData        = _this_send;
+    end->vtable.ReadRxBuff      = _this_read;
+    end->vtable.GetMaxDataLeng  = _this_max;
+    end->vtable.GetRxTs         = _this_rx_ts;
+    end->base.vtable            = &end->vtable;
+    end->sim                    = cthis;
+    end->Id                     = dir;
+  }
+
+  return cthis;
+}
+
+/**
+ * @brief InterfaceSim class destructor
+ *
+ * @param cthis pointer to @ref InterfaceSim_t
+ */
+void InterfaceSim_dtor(InterfaceSim_t* cthis)
+{
+  if(cthis == NULL)
+    return;
+
+  heap_free(cthis->Path[0].Fifo);
+  heap_free(cthis->Path[1].Fifo);
+  heap_free(cthis->Pool);
+  heap_free(cthis);
+}
+
+/**
+ * @brief Get driver of one link end for @ref Interface_ctor
+ *
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @param end   0 or 1
+ * @return HWInterface_t* driver, NULL if no such end
+ */
+HWInterface_t* InterfaceSim_GetHw(InterfaceSim_t* cthis,size_t end)
+{
+  return (end < 2) ? &cthis->End[end].base : NULL;
+}
+
+/**
+ * @brief Set model of one direction, frames already in flight keep their fate
+ *
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @param dir   0 - end 0 to end 1, 1 - end 1 to end 0
+ * @param cfg   pointer to @ref sInterfaceSimPathCfg_t
+ * @return true   if set
+ * @return false  bad direction or chunk range
+ */
+bool InterfaceSim_SetPath(InterfaceSim_t* cthis,size_t dir,const sInterfaceSimPathCfg_t* cfg)
+{
+  if((dir >= 2)||(cfg == NULL)
+   ||((cfg->ChunkMax != 0)&&((cfg->ChunkMin == 0)||(cfg->ChunkMin > cfg->ChunkMax))))
+    return false;
+
+  cthis->Path[dir].cfg = *cfg;
+  if(cthis->Path[dir].cfg.ByteBits == 0)
+    cthis->Path[dir].cfg.ByteBits = SIM_DEF_BYTE_BITS;
+
+  _this_path_reset(cthis,&cthis->Path[dir]);
+  return true;
+}
+
+/**
+ * @brief Move virtual time to the next link event, at most MaxNs
+ * @details in irq mode due chunks and tx complete are raised here
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @param MaxNs longest step
+ * @return uint64_t ns advanced
+ */
+uint64_t InterfaceSim_Advance(InterfaceSim_t* cthis,uint64_t MaxNs)
+{
+  uint64_t start  = cthis->Now;
+  uint64_t target = (MaxNs > SIM_NEVER-start) ? SIM_NEVER : start+MaxNs;
+  uint64_t next   = InterfaceSim_NextEvent(cthis);
+
+  if(next < target)
+    target = next;
+
+  cthis->Now = target;
+
+  for(size_t i = 0; (i < SIM_MAX_FIRE)&&_this_fire(cthis); i++);
+
+  return cthis->Now-start;
+}
+
+/**
+ * @brief Get time of the next link event after now
+ *
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @return uint64_t virtual ns, UINT64_MAX if nothing is in flight
+ */
+uint64_t InterfaceSim_NextEvent(InterfaceSim_t* cthis)
+{
+  uint64_t next = SIM_NEVER;
+
+  for(size_t dir = 0; dir < 2; dir++)
+  {
+    sSimPath_t* path = &cthis->Path[dir];
+
+    if((path->TxBusyUntil > cthis->Now)&&(path->TxBusyUntil < next))
+      next = path->TxBusyUntil;
+
+    for(size_t i = 0; i < path->Count; i++)
+    {
+      uint64_t arrive = path->Fifo[(path->Head+i)%cthis->Deep].Arrive;
+
+      if(arrive > cthis->Now)
+      {
+        if(arrive < next)
+          next = arrive;
+        break; /* sorted*/
+      }
+    }
+  }
+
+  return next;
+}
+
+/**
+ * @brief Get virtual time
+ *
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @return uint64_t ns since ctor
+ */
+uint64_t InterfaceSim_Now(InterfaceSim_t* cthis) {return cthis->Now;}
+
+/**
+ * @brief Virtual time tick, @ref InterfaceGetTick
+ *
+ * @param sim pointer to @ref InterfaceSim_t
+ * @return uint32_t TickNs ticks, wraps around
+ */
+uint32_t InterfaceSim_Tick(void* sim)
+{
+  InterfaceSim_t* cthis = sim;
+
+  return (uint32_t)(cthis->Now/cthis->TickNs);
+}
+
+/**
+ * @brief Virtual time, @ref InterfaceGetTime
+ *
+ * @param sim pointer to @ref InterfaceSim_t
+ * @return uint64_t ns
+ */
+uint64_t InterfaceSim_Time(void* sim) {return ((InterfaceSim_t*)sim)->Now;}
+
+/**
+ * @brief Check nothing is on the wire or waiting in receiver FIFO
+ *
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @return true   if idle
+ * @return false  else
+ */
+bool InterfaceSim_IsIdle(InterfaceSim_t* cthis)
+{
+  return (cthis->Path[0].Count == 0)&&(cthis->Path[1].Count == 0)
+       &&(cthis->Path[0].TxBusyUntil <= cthis->Now)&&(cthis->Path[1].TxBusyUntil <= cthis->Now);
+}
+
+/**
+ * @brief Get direction statistic
+ *
+ * @param[in]  cthis pointer to @ref InterfaceSim_t
+ * @param[in]  dir   0 - end 0 to end 1, 1 - end 1 to end 0
+ * @param[out] stats pointer to @ref sInterfaceSimStats_t
+ */
+void InterfaceSim_GetStats(InterfaceSim_t* cthis,size_t dir,sInterfaceSimStats_t* stats)
+{
+  if(dir < 2)
+    *stats = cthis->Path[dir].stats;
+}
+
+/**
+ * @brief xorshift64*
+ *
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @return uint64_t random
+ */
+static inline uint64_t _this_rand(InterfaceSim_t* cthis)
+{
+  cthis->Rng ^= cthis->Rng >> 12;
+  cthis->Rng ^= cthis->Rng << 25;
+  cthis->Rng ^= cthis->Rng >> 27;
+  return cthis->Rng*0x2545F4914F6CDD1Dull;
+}
+
+/**
+ * @brief Uniform random in (0,1]
+ *
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @return double random
+ */
+static inline double _this_uniform(InterfaceSim_t* cthis)
+{
+  return (double)((_this_rand(cthis) >> 11)+1)*(1.0/9007199254740992.0);
+}
+
+/**
+ * @brief Number of trials before the first success
+ * @note  one draw per event instead of one per bit, a clean frame costs nothing
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @param p     success probability
+ * @return uint64_t trials, UINT64_MAX if p is 0
+ */
+static uint64_t _this_geometric(InterfaceSim_t* cthis,double p)
+{
+  if(p <= 0.0)
+    return SIM_NEVER;
+  if(p >= 1.0)
+    return 0;
+
+  double n = floor(log(_this_uniform(cthis))/log1p(-p));
+
+  return (n >= 1.8e19) ? SIM_NEVER : (uint64_t)n;
+}
+
+/**
+ * @brief Restart error process of a direction
+ *
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @param path  pointer to direction
+ */
+static void _this_path_reset(InterfaceSim_t* cthis,sSimPath_t* path)
+{
+  path->InBurst      = false;
+  path->BitsToErr    = _this_geometric(cthis,path->cfg.Ber);
+  path->BitsToSwitch = _this_geometric(cthis,path->cfg.BurstRate);
+}
+
+/**
+ * @brief Flip bits of a frame by the error process of its direction
+ * @details two state (Gilbert-Elliott) bit error process, clean and burst state
+ *          have own BER, state lengths are geometric
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @param path  pointer to direction
+ * @param data  frame
+ * @param len   frame leng
+ */
+static void _this_corrupt(InterfaceSim_t* cthis,sSimPath_t* path,uint8_t* data,size_t len)
+{
+  uint64_t bits   = (uint64_t)len*8u;
+  uint64_t pos    = 0;
+  uint64_t errors = 0;
+
+  while(pos < bits)
+  {
+    uint64_t step = (path->BitsToErr < path->BitsToSwitch) ? path->BitsToErr : path->BitsToSwitch;
+
+    if(step >= bits-pos)
+    {
+      path->BitsToErr    -= (path->BitsToErr == SIM_NEVER) ? 0 : bits-pos;
+      path->BitsToSwitch -= (path->BitsToSwitch == SIM_NEVER) ? 0 : bits-pos;
+      break;
+    }
+
+    pos                += step;
+    path->BitsToErr    -= step;
+    path->BitsToSwitch -= step;
+
+    if(path->BitsToSwitch == 0)
+    {
+      path->InBurst = !path->InBurst;
+      if(path->InBurst)
+      {
+        path->stats.Bursts++;
+        path->BitsToSwitch = _this_geometric(cthis,(path->cfg.BurstBits > 1.0) ? 1.0/path->cfg.BurstBits : 1.0)+1;
+      }
+      else
+        path->BitsToSwitch = _this_geometric(cthis,path->cfg.BurstRate);
+      path->BitsToErr = _this_geometric(cthis,path->InBurst ? path->cfg.BurstBer : path->cfg.Ber);
+      continue;
+    }
+
+    data[pos/8] ^= (uint8_t)(1u << (pos%8));
+    errors++;
+    pos++;
+    path->BitsToSwitch -= (path->BitsToSwitch == SIM_NEVER) ? 0 : 1;
+    path->BitsToErr     = _this_geometric(cthis,path->InBurst ? path->cfg.BurstBer : path->cfg.Ber);
+  }
+
+  if(errors != 0)
+  {
+    path->stats.Corrupted++;
+    path->stats.BitErrors += errors;
+  }
+}
+
+/**
+ * @brief Read arrived data of a direction
+ * @details frame mode returns one frame, chunk mode a random size piece of
+ *          the byte stream, it may end inside a frame or span several frames
+ * @param[in]  cthis   pointer to @ref InterfaceSim_t
+ * @param[in]  path    pointer to direction
+ * @param[out] dst     destination
+ * @param[out] len     data leng
+ * @param[in]  max_len destination size
+ * @return true   if data read
+ * @return false  nothing arrived
+ */
+static bool _this_take(InterfaceSim_t* cthis,sSimPath_t* path,uint8_t* dst,size_t* len,size_t max_len)
+{
+  if((path->Count == 0)||(path->Fifo[path->Head].Arrive > cthis->Now)||(max_len == 0))
+    return false;
+
+  size_t want = path->cfg.ChunkMax;
+
+  if(want == 0)
+  {
+    sSimFrame_t* frame = &path->Fifo[path->Head];
+
+    want = frame->Leng;
+    if(want > max_len)
+    {
+      want = max_len;
+      path->stats.Truncated++;
+    }
+    memcpy(dst,frame->Data,want);
+    path->LastRxTs = frame->Arrive;
+    path->Head     = (path->Head+1)%cthis->Deep;
+    path->Count--;
+  }
+  else
+  {
+    size_t got = 0;
+
+    if(path->cfg.ChunkMax > path->cfg.ChunkMin)
+      want = path->cfg.ChunkMin+(size_t)(_this_rand(cthis)%(path->cfg.ChunkMax-path->cfg.ChunkMin+1));
+    if(want > max_len)
+      want = max_len;
+
+    while((got < want)&&(path->Count != 0)&&(path->Fifo[path->Head].Arrive <= cthis->Now))
+    {
+      sSimFrame_t* frame = &path->Fifo[path->Head];
+      size_t       part  = frame->Leng-path->HeadPos;
+
+      if(part > want-got)
+        part = want-got;
+      memcpy(&dst[got],&frame->Data[path->HeadPos],part);
+      got            += part;
+      path->HeadPos  += part;
+      path->LastRxTs  = frame->Arrive;
+
+      if(path->HeadPos == frame->Leng)
+      {
+        path->HeadPos = 0;
+        path->Head    = (path->Head+1)%cthis->Deep;
+        path->Count--;
+      }
+    }
+    want = got;
+  }
+
+  path->stats.RxReads++;
+  path->stats.RxBytes += want;
+  *len = want;
+  return true;
+}
+
+/**
+ * @brief Raise due irq of both ends
+ *
+ * @param cthis pointer to @ref InterfaceSim_t
+ * @return true   if any callback ran
+ * @return false  nothing due
+ */
+static bool _this_fire(InterfaceSim_t* cthis)
+{
+  bool fired = false;
+
+  for(size_t id = 0; id < 2; id++)
+  {
+    sSimEnd_t*               end = &cthis->End[id];
+    sInterfaceIrqCallback_t* cb  = end->vtable.irqcb;
+    size_t                   len;
+
+    if(cb == NULL)
+      continue;
+
+    if(end->TxPending&&(cthis->Path[id].TxBusyUntil <= cthis->Now))
+    {
+      end->TxPending = false;
+      if(cb->tx_cb != NULL)
+      {
+        cb->tx_cb(cb->parent);
+        fired = true;
+      }
+    }
+
+    while((cb->rx_cb != NULL)&&(end->RxHw != NULL)
+        &&_this_take(cthis,&cthis->Path[id^1],end->RxHw,&len,end->RxHwLen))
+    {
+      cb->rx_cb(cb->parent,end->RxHw,len);
+      fired = true;
+    }
+  }
+
+  return fired;
+}
+
+/**
+ * @brief Link irq mode rx buffer
+ *
+ * @param hw   pointer to end
+ * @param data rx buffer
+ * @param len  rx buffer size
+ */
+static void _this_set_rx(void* hw,uint8_t* data,size_t len)
+{
+  sSimEnd_t* end = hw;
+
+  end->RxHw    = data;
+  end->RxHwLen = len;
+}
+
+static void   _this_set_buff(void* hw,uint8_t* data,size_t len) {(void)hw;(void)data;(void)len;}
+static void   _this_nop(void* hw)   {(void)hw;}
+static bool   _this_true(void* hw)  {(void)hw;return true;}
+static size_t _this_max(void* hw)   {return ((sSimEnd_t*)hw)->sim->MaxFrame;}
+
+/**
+ * @brief Check wire is free
+ *
+ * @param hw pointer to end
+ * @return true   if last frame is serialized
+ * @return false  else
+ */
+static bool _this_free(void* hw)
+{
+  sSimEnd_t* end = hw;
+
+  return end->sim->Path[end->Id].TxBusyUntil <= end->sim->Now;
+}
+
+/**
+ * @brief Put frame on the wire
+ * @details wire time is taken even by frames lost later, a lost frame is
+ *          still reported as sent
+ * @param hw   pointer to end
+ * @param data frame
+ * @param len  frame leng
+ * @return true   if sent
+ * @return false  wire busy or frame too long
+ */
+static bool _this_send(void* hw,const uint8_t* data,size_t len)
+{
+  sSimEnd_t*      end   = hw;
+  InterfaceSim_t* cthis = end->sim;
+  sSimPath_t*     path  = &cthis->Path[end->Id];
+
+  if(path->TxBusyUntil > cthis->Now)
+  {
+    path->stats.TxBusy++;
+    return false;
+  }
+  if((len == 0)||(len > cthis->MaxFrame))
+    return false;
+
+  uint64_t wire = (path->cfg.Baud == 0) ? 0
+                : ((uint64_t)len*path->cfg.ByteBits*1000000000u+path->cfg.Baud-1)/path->cfg.Baud;
+
+  path->TxBusyUntil    = cthis->Now+wire;
+  path->stats.WireNs  += wire;
+  path->stats.TxFrames++;
+  path->stats.TxBytes += len;
+  end->TxPending       = true;
+
+  if((path->cfg.DropRate > 0.0)&&(_this_uniform(cthis) <= path->cfg.DropRate))
+  {
+    path->stats.Dropped++;
+    return true;
+  }
+  if(path->Count == cthis->Deep)
+  {
+    path->stats.Overflows++;
+    return true;
+  }
+
+  uint64_t arrive = path->TxBusyUntil+path->cfg.LatencyNs;
+
+  if(path->cfg.JitterNs != 0)
+    arrive += _this_rand(cthis)%(path->cfg.JitterNs+1);
+  if(!path->cfg.Reorder&&(arrive < path->LastArrive))
+    arrive = path->LastArrive;
+  path->LastArrive = arrive;
+
+  /* insert sorted by arrival, from the tail*/
+  size_t idx = (path->Head+path->Count)%cthis->Deep;
+
+  path->Fifo[idx].Arrive = arrive;
+  path->Fifo[idx].Leng   = len;
+  memcpy(path->Fifo[idx].Data,data,len);
+  _this_corrupt(cthis,path,path->Fifo[idx].Data,len);
+
+  for(size_t i = path->Count; i > 0; i--)
+  {
+    size_t prev = (idx+cthis->Deep-1)%cthis->Deep;
+
+    if((path->Fifo[prev].Arrive <= arrive)||((i == 1)&&(path->HeadPos != 0)))
+      break;
+
+    sSimFrame_t tmp   = path->Fifo[prev];
+    path->Fifo[prev]  = path->Fifo[idx];
+    path->Fifo[idx]   = tmp;
+    idx               = prev;
+  }
+
+  if(++path->Count > path->stats.MaxQueue)
+    path->stats.MaxQueue = path->Count;
+
+  return true;
+}
+
+/**
+ * @brief Read arrived data (process mode)
+ *
+ * @param[in]  hw      pointer to end
+ * @param[out] data    destination
+ * @param[out] len     data leng
+ * @param[in]  max_len destination size
+ * @return true   if data read
+ * @return false  nothing arrived
+ */
+static bool _this_read(void* hw,uint8_t* data,size_t* len,size_t max_len)
+{
+  sSimEnd_t* end = hw;
+
+  return _this_take(end->sim,&end->sim->Path[end->Id^1],data,len,max_len);
+}
+
+/**
+ * @brief Arrival time of last read data, virtual ns
+ *
+ * @param[in]  hw pointer to end
+ * @param[out] ts time stamp
+ * @return true   always
+ */
+static bool _this_rx_ts(void* hw,uint64_t* ts)
+{
+  sSimEnd_t* end = hw;
+
+  *ts = end->sim->Path[end->Id^1].LastRxTs;
+  return true;
+}
+
+/** @}*/
@@ -0,0 +1,128 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceSim.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceSim.c (virtual time link simulator driver)
+  * @version  V1.0.0
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_SIM_H__
+#define __INTERFACE_SIM_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Interface.h"
+#include "InterfacePrivate.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Sim Interface link simulator driver
+ * @brief    Two @ref HWInterface_t ends of a modelled link in virtual time
+ * @details  Every direction has its own model: serialization at a baud rate,
+ *           propagation latency with jitter, random bit errors, Gilbert-Elliott
+ *           error bursts, frame drops, a bounded receiver FIFO and receiver side
+ *           chunking of the byte stream. Nothing sleeps, the owner moves the
+ *           clock with @ref InterfaceSim_Advance, which jumps straight to the
+ *           next link event, so hours of link time run in seconds. Runs are
+ *           repeatable for the same Seed.
+ * @{
+ */
+
+typedef struct InterfaceSim InterfaceSim_t;   /*!< Interface link simulator Class typedef*/
+
+/**
+ * @brief One direction of the link
+ *
+ */
+typedef struct
+{
+  uint32_t  Baud;       /*!< Line rate in bit/s, 0 - no serialization delay*/
+  uint8_t   ByteBits;   /*!< Line bits per byte (start, data, parity, stop), 0 - 10*/
+  uint64_t  LatencyNs;  /*!< Propagation delay*/
+  uint64_t  JitterNs;   /*!< Extra delay, uniform 0..JitterNs*/
+  bool      Reorder;    /*!< Jitter may reorder frames, else arrival order is kept*/
+  double    Ber;        /*!< Bit error rate*/
+  double    DropRate;   /*!< Probability a frame is lost as a whole*/
+  double    BurstRate;  /*!< Probability per bit a burst starts, 0 - no bursts*/
+  double    BurstBits;  /*!< Mean burst length in bits*/
+  double    BurstBer;   /*!< Bit error rate inside a burst*/
+  size_t    ChunkMin;   /*!< Receiver reads the byte stream in ChunkMin..ChunkMax pieces*/
+  size_t    ChunkMax;   /*!< 0 - receiver reads whole frames*/
+}sInterfaceSimPathCfg_t;
+
+/**
+ * @brief Link configuration
+ *
+ */
+typedef struct
+{
+  size_t                  MaxFrame; /*!< Max frame leng*/
+  size_t                  Deep;     /*!< Receiver FIFO, frames in flight per direction*/
+  uint64_t                TickNs;   /*!< Tick of @ref InterfaceSim_Tick, 0 - 1 ms*/
+  uint64_t                Seed;     /*!< Random seed, 0 - fixed default*/
+  sInterfaceSimPathCfg_t  Path[2];  /*!< [0] - end 0 to end 1, [1] - end 1 to end 0*/
+}sInterfaceSimCfg_t;
+
+/**
+ * @brief Direction statistic
+ *
+ */
+typedef struct
+{
+  uint64_t  TxFrames;   /*!< Frames put on the wire*/
+  uint64_t  TxBytes;
+  uint64_t  TxBusy;     /*!< SendData refused, wire busy*/
+  uint64_t  Dropped;    /*!< Frames lost by DropRate*/
+  uint64_t  Overflows;  /*!< Frames lost, receiver FIFO full*/
+  uint64_t  Corrupted;  /*!< Frames with bit errors*/
+  uint64_t  BitErrors;
+  uint64_t  Bursts;     /*!< Error bursts started*/
+  uint64_t  RxReads;    /*!< Successful reads (frames or chunks)*/
+  uint64_t  RxBytes;
+  uint64_t  Truncated;  /*!< Frames cut to the reader buffer*/
+  uint64_t  WireNs;     /*!< Time the wire was busy*/
+  size_t    MaxQueue;   /*!< Max frames in flight*/
+}sInterfaceSimStats_t;
+
+/**
+ * @defgroup Interface_Sim_public_func Interface link simulator public function
+ * @{
+ */
+  InterfaceSim_t*     InterfaceSim_ctor(const sInterfaceSimCfg_t* cfg);
+  void                InterfaceSim_dtor(InterfaceSim_t* cthis);
+
+  HWInterface_t*      InterfaceSim_GetHw(InterfaceSim_t* cthis,size_t end);
+  bool                InterfaceSim_SetPath(InterfaceSim_t* cthis,size_t dir,const sInterfaceSimPathCfg_t* cfg);
+
+  uint64_t            InterfaceSim_Advance(InterfaceSim_t* cthis,uint64_t MaxNs);
+  uint64_t            InterfaceSim_NextEvent(InterfaceSim_t* cthis);
+  uint64_t            InterfaceSim_Now(InterfaceSim_t* cthis);
+  uint32_t            InterfaceSim_Tick(void* sim);
+  uint64_t            InterfaceSim_Time(void* sim);
+  bool                InterfaceSim_IsIdle(InterfaceSim_t* cthis);
+
+  void                InterfaceSim_GetStats(InterfaceSim_t* cthis,size_t dir,sInterfaceSimStats_t* stats);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
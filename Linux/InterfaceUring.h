@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file    InterfaceUring.h
+  * @author  Wyrm
+  * @brief   header file for InterfaceUring.c (Linux io_uring driver)
+  * @version  V1.0.1
+  * @date     19. Oct. 2026
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __INTERFACE_URING_H__
+#define __INTERFACE_URING_H__
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Interface.h"
+#include "InterfacePrivate.h"
+
+/**
+ * @addtogroup Interface
+ * @{
+ */
+
+/**
+ * @defgroup Interface_Uring Interface Linux io_uring driver
+ * @brief    @ref HWInterface_t over io_uring on a message fd (SOCK_SEQPACKET, datagram)
+ * @details  On sockets one multishot recv takes RxDepth buffers from a provided buffer
+ *           ring, on other fds RxDepth reads stay posted into registered buffers. One
+ *           completion is one frame for ReadRxBuff. Frames of SendData wait in registered tx slots
+ *           and go out as one linked batch of writes, the next batch is submitted
+ *           when the previous one completed. Completions are reaped from the shared
+ *           ring without syscalls, io_uring_enter is called only to submit.
+ * @note     Per frame of a busy link it costs as much cpu time as send()/recv() or more,
+ *           the kernel work per request takes what the saved syscalls gave. The gain
+ *           is a poll of an idle link without syscall, see InterfaceUring.c.
+ * @{
+ */
+
+typedef struct InterfaceUring InterfaceUring_t;   /*!< Interface io_uring driver Class typedef*/
+
+/**
+ * @brief io_uring driver config
+ *
+ */
+typedef struct
+{
+  size_t    MaxFrame;     /*!< Rx buffer and tx slot size, GetMaxDataLeng*/
+  uint16_t  RxDepth;      /*!< Rx buffers (posted reads)*/
+  uint16_t  TxSlots;      /*!< Tx frames queued or in flight*/
+  uint32_t  SqPollMs;     /*!< >0 - kernel SQ polling thread idle time, no submit syscalls, needs a spare cpu*/
+}sInterfaceUringCfg_t;
+
+/**
+ * @brief io_uring driver statistic
+ *
+ */
+typedef struct
+{
+  uint64_t  Enters;       /*!< io_uring_enter calls*/
+  uint64_t  RxFrames;
+  uint64_t  TxFrames;
+  uint64_t  TxBatches;
+  uint64_t  RxErrors;     /*!< failed reads, EOF*/
+  uint64_t  TxErrors;     /*!< failed, short or cancelled writes*/
+}sInterfaceUringStats_t;
+
+/**
+ * @defgroup Interface_Uring_public_func Interface io_uring driver public function
+ * @{
+ */
+  InterfaceUring_t*   InterfaceUring_ctorFd(int fd,const sInterfaceUringCfg_t* cfg);
+  void                InterfaceUring_dtor(InterfaceUring_t* cthis);
+
+  HWInterface_t*      InterfaceUring_GetHw(InterfaceUring_t* cthis);
+  int                 InterfaceUring_GetWaitFd(InterfaceUring_t* cthis);
+  bool                InterfaceUring_Flush(InterfaceUring_t* cthis);
+  void                InterfaceUring_GetStats(InterfaceUring_t* cthis,sInterfaceUringStats_t* stats);
+/** @}*/
+
+/** @}*/
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
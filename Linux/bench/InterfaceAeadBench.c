@@ -0,0 +1,215 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceAeadBench.c
+ * @author   Wyrm
+ * @brief    Per frame cost of the @ref InterfaceAead_t stage
+ * @version  V1.0.1
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_aead_bench [frames]
+
+  rfc 8439  - AEAD test vector of RFC 8439 2.8.2 (ciphertext, tag, open and
+              tampered tag), the bench fails with exit code 1 if it does not match
+  seal/open - InterfaceAead_Seal + InterfaceAead_Open of one frame in place,
+              ns per frame and MB/s of payload per frame size
+  pipeline  - Interface_SendData, poll and Interface_readData over an
+              @ref InterfaceSim_t link without delay, with and without the
+              stage, ns per frame and the share the stage adds
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "Interface.h"
+#include "InterfaceAead.h"
+#include "InterfaceSim.h"
+
+#define BENCH_MAX_FRAME 1024u
+
+static const size_t sizes[] = {16,64,256,1024-INTERFACE_AEAD_OVERHEAD-8};
+
+static const uint8_t rfc_key[32] =
+{
+  0x80,0x81,0x82,0x83,0x84,0x85,0x86,0x87,0x88,0x89,0x8a,0x8b,0x8c,0x8d,0x8e,0x8f,
+  0x90,0x91,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0x9b,0x9c,0x9d,0x9e,0x9f,
+};
+static const uint8_t rfc_nonce[12] = {0x07,0x00,0x00,0x00,0x40,0x41,0x42,0x43,0x44,0x45,0x46,0x47};
+static const uint8_t rfc_aad[12]   = {0x50,0x51,0x52,0x53,0xc0,0xc1,0xc2,0xc3,0xc4,0xc5,0xc6,0xc7};
+static const char    rfc_text[]    = "Ladies and Gentlemen of the class of '99: If I could offer you only one tip "
+                                     "for the future, sunscreen would be it.";
+static const uint8_t rfc_cipher[114] =
+{
+  0xd3,0x1a,0x8d,0x34,0x64,0x8e,0x60,0xdb,0x7b,0x86,0xaf,0xbc,0x53,0xef,0x7e,0xc2,
+  0xa4,0xad,0xed,0x51,0x29,0x6e,0x08,0xfe,0xa9,0xe2,0xb5,0xa7,0x36,0xee,0x62,0xd6,
+  0x3d,0xbe,0xa4,0x5e,0x8c,0xa9,0x67,0x12,0x82,0xfa,0xfb,0x69,0xda,0x92,0x72,0x8b,
+  0x1a,0x71,0xde,0x0a,0x9e,0x06,0x0b,0x29,0x05,0xd6,0xa5,0xb6,0x7e,0xcd,0x3b,0x36,
+  0x92,0xdd,0xbd,0x7f,0x2d,0x77,0x8b,0x8c,0x98,0x03,0xae,0xe3,0x28,0x09,0x1b,0x58,
+  0xfa,0xb3,0x24,0xe4,0xfa,0xd6,0x75,0x94,0x55,0x85,0x80,0x8b,0x48,0x31,0xd7,0xbc,
+  0x3f,0xf4,0xde,0xf0,0x8e,0x4b,0x7a,0x9d,0xe5,0x76,0xd2,0x65,0x86,0xce,0xc6,0x4b,
+  0x61,0x16,
+};
+static const uint8_t rfc_tag[16] = {0x1a,0xe1,0x0b,0x59,0x4f,0x09,0xe2,0x6a,0x7e,0x90,0x2e,0xcb,0xd0,0x60,0x06,0x91};
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+static void make_pair(InterfaceAead_t** a,InterfaceAead_t** b)
+{
+  sInterfaceAeadCfg_t cfg = {.TxId = 1,.RxId = 2};
+
+  for(size_t i = 0; i < INTERFACE_AEAD_KEY_SIZE; i++)
+    cfg.Key[i] = (uint8_t)(i*7+1);
+
+  *a = InterfaceAead_ctor(&cfg);
+  cfg.TxId = 2;
+  cfg.RxId = 1;
+  *b = InterfaceAead_ctor(&cfg);
+}
+
+static bool check_rfc8439(void)
+{
+  uint8_t ct[sizeof(rfc_cipher)];
+  uint8_t pt[sizeof(rfc_cipher)];
+  uint8_t tag[INTERFACE_AEAD_TAG_SIZE];
+  size_t  len = sizeof(rfc_text)-1;
+
+  InterfaceAead_Encrypt(rfc_key,rfc_nonce,rfc_aad,sizeof(rfc_aad),ct,(const uint8_t*)rfc_text,len,tag);
+
+  bool ok = (len == sizeof(rfc_cipher))&&
+            (memcmp(ct,rfc_cipher,len) == 0)&&
+            (memcmp(tag,rfc_tag,sizeof(tag)) == 0)&&
+            InterfaceAead_Decrypt(rfc_key,rfc_nonce,rfc_aad,sizeof(rfc_aad),pt,rfc_cipher,len,rfc_tag)&&
+            (memcmp(pt,rfc_text,len) == 0);
+
+  tag[0] ^= 1;
+  ok = ok && !InterfaceAead_Decrypt(rfc_key,rfc_nonce,rfc_aad,sizeof(rfc_aad),pt,rfc_cipher,len,tag);
+
+  printf("rfc 8439 2.8.2 test vector: %s\n",ok ? "ok" : "FAILED");
+  return ok;
+}
+
+static void bench_seal_open(size_t frames)
+{
+  printf("seal/open: ChaCha20-Poly1305, %zu frames\n",frames);
+
+  for(size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++)
+  {
+    InterfaceAead_t* a;
+    InterfaceAead_t* b;
+    uint8_t          buf[BENCH_MAX_FRAME];
+    size_t           ok = 0;
+
+    make_pair(&a,&b);
+    memset(buf,0x5A,sizeof(buf));
+
+    uint64_t wall = now_ns();
+    for(size_t i = 0; i < frames; i++)
+    {
+      size_t len = InterfaceAead_Seal(a,buf,buf,sizes[s],sizeof(buf));
+      ok += (InterfaceAead_Open(b,buf,buf,len,sizeof(buf)) == sizes[s]);
+    }
+    wall = now_ns()-wall;
+
+    printf("  %4zu B  %7.0f ns/frame  %7.1f MB/s  (+%u B on wire)  %s\n",
+           sizes[s],(double)wall/(double)frames,(double)(sizes[s]*frames)*1e3/(double)wall,
+           INTERFACE_AEAD_OVERHEAD,(ok == frames) ? "ok" : "FAILED");
+
+    InterfaceAead_dtor(a);
+    InterfaceAead_dtor(b);
+  }
+}
+
+static double pipeline(size_t size,size_t frames,bool aead)
+{
+  sInterfaceSimCfg_t cfg = {.MaxFrame = BENCH_MAX_FRAME+8,.Deep = 64,.Seed = 1};
+
+  InterfaceSim_t*    sim = InterfaceSim_ctor(&cfg);
+  InterfaceHandel_t* tx  = Interface_ctor(InterfaceSim_GetHw(sim,0),BENCH_MAX_FRAME,16);
+  InterfaceHandel_t* rx  = Interface_ctor(InterfaceSim_GetHw(sim,1),BENCH_MAX_FRAME,16);
+  InterfaceAead_t*   a   = NULL;
+  InterfaceAead_t*   b   = NULL;
+  uint8_t            buf[BENCH_MAX_FRAME];
+  size_t             got = 0;
+
+  if(aead)
+  {
+    sInterfaceStage_t stage;
+
+    make_pair(&a,&b);
+    InterfaceAead_GetStage(a,&stage);
+    Interface_AddStage(tx,&stage);
+    InterfaceAead_GetStage(b,&stage);
+    Interface_AddStage(rx,&stage);
+  }
+
+  memset(buf,0x5A,sizeof(buf));
+
+  uint64_t wall = now_ns();
+  for(size_t i = 0; i < frames; i++)
+  {
+    Interface_SendData(tx,buf,size);
+    InterfaceSim_Advance(sim,1000);
+    while(Interface_poll(tx)|Interface_poll(rx));
+    got += (Interface_readData(rx,buf) == size);
+  }
+  wall = now_ns()-wall;
+
+  if(got != frames)
+    printf("  lost %zu frames\n",frames-got);
+
+  Interface_dtor(tx);
+  Interface_dtor(rx);
+  InterfaceAead_dtor(a);
+  InterfaceAead_dtor(b);
+  InterfaceSim_dtor(sim);
+
+  return (double)wall/(double)frames;
+}
+
+static void bench_pipeline(size_t frames)
+{
+  printf("pipeline: send, poll, read over a sim link, %zu frames\n",frames);
+
+  for(size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++)
+  {
+    double plain = pipeline(sizes[s],frames,false);
+    double aead  = pipeline(sizes[s],frames,true);
+
+    printf("  %4zu B  plain %7.0f ns/frame  aead %7.0f ns/frame  stage +%5.0f ns (%4.0f %%)\n",
+           sizes[s],plain,aead,aead-plain,100.0*(aead-plain)/plain);
+  }
+}
+
+int main(int argc,char** argv)
+{
+  size_t frames = 100000;
+
+  if(argc > 1)
+    frames = strtoul(argv[1],NULL,0);
+
+  if(!check_rfc8439())
+    return 1;
+
+  bench_seal_open(frames);
+  bench_pipeline(frames/10);
+
+  return 0;
+}
@@ -0,0 +1,197 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceArqBench.c
+ * @author   Wyrm
+ * @brief    Goodput of @ref InterfaceArq_t against frame loss on @ref InterfaceSim_t links
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_arq_bench [frames] [seed]
+
+  Everything runs in virtual time, 1 tick = 1 ms.
+  loss      - window 16, 200 B frames over a link with 5 ms latency and
+              0..3 ms jitter that reorders, no line rate limit, frame loss
+              0..30 %, goodput in frames per 1000 ticks, retransmits and
+              in order check per loss rate
+  slow rx   - same link at 5 % loss, receiver with CircDeep 4 reads one
+              frame every 1..8 ticks, frames delivered and rx queue drops
+              (must stay 0, acked frames wait in the ARQ window)
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "Interface.h"
+#include "InterfaceArq.h"
+#include "InterfaceSim.h"
+
+#define BENCH_MS      1000000ull
+#define BENCH_PAYLOAD 200u
+
+static uint64_t seed = 1;
+
+/**
+ * @brief Link and both ARQ ends under test
+ *
+ */
+typedef struct
+{
+  InterfaceSim_t*     Sim;
+  InterfaceHandel_t*  A;
+  InterfaceHandel_t*  B;
+  InterfaceArq_t*     Qa;
+  InterfaceArq_t*     Qb;
+}sBenchLink_t;
+
+static void link_open(sBenchLink_t* l,double loss,size_t circdeep)
+{
+  sInterfaceSimCfg_t cfg = {.MaxFrame = 256,.Deep = 64,.TickNs = BENCH_MS,.Seed = seed};
+
+  cfg.Path[0] = (sInterfaceSimPathCfg_t){.LatencyNs = 5*BENCH_MS,.JitterNs = 3*BENCH_MS,.Reorder = true,.DropRate = loss};
+  cfg.Path[1] = cfg.Path[0];
+
+  sInterfaceArqCfg_t acfg = {.Window = 16,.MaxPayload = BENCH_PAYLOAD,.RtoInit = 30,.RtoMin = 5,.RtoMax = 500};
+
+  l->Sim = InterfaceSim_ctor(&cfg);
+  l->A   = Interface_ctor(InterfaceSim_GetHw(l->Sim,0),256,64);
+  l->B   = Interface_ctor(InterfaceSim_GetHw(l->Sim,1),256,circdeep);
+
+  acfg.Clock = (sInterfaceClock_t){.parent = l->Sim,.func = InterfaceSim_Tick};
+  l->Qa = InterfaceArq_ctor(l->A,&acfg);
+  l->Qb = InterfaceArq_ctor(l->B,&acfg);
+  Interface_InstallArq(l->A,l->Qa);
+  Interface_InstallArq(l->B,l->Qb);
+}
+
+static void link_close(sBenchLink_t* l)
+{
+  Interface_dtor(l->A);
+  Interface_dtor(l->B);
+  InterfaceArq_dtor(l->Qa);
+  InterfaceArq_dtor(l->Qb);
+  InterfaceSim_dtor(l->Sim);
+}
+
+/**
+ * @brief Move frames for one tick: send while window is free, run the link, read
+ *
+ * @param l       link
+ * @param sent    frames sent so far
+ * @param frames  frames to send
+ * @param got     frames received so far
+ * @param reads   max frames read by receiver
+ * @param order   cleared on out of order frame
+ */
+static void link_tick(sBenchLink_t* l,size_t* sent,size_t frames,size_t* got,size_t reads,bool* order)
+{
+  uint8_t buf[256];
+
+  while((*sent < frames)&&InterfaceArq_IsTxFree(l->Qa))
+  {
+    memset(buf,0,BENCH_PAYLOAD);
+    buf[0] = (uint8_t)(*sent);
+    buf[1] = (uint8_t)(*sent >> 8);
+    InterfaceArq_Send(l->Qa,buf,BENCH_PAYLOAD);
+    (*sent)++;
+  }
+
+  /* step the link through the whole tick, polls at every event*/
+  uint64_t end = InterfaceSim_Now(l->Sim)+BENCH_MS;
+  do
+    while(Interface_poll(l->A)|Interface_poll(l->B));
+  while(InterfaceSim_Advance(l->Sim,end-InterfaceSim_Now(l->Sim)) != 0);
+
+  for(size_t n = 0; n < reads; n++)
+  {
+    if(Interface_readData(l->B,buf) == 0)
+      break;
+    *order &= ((uint16_t)(buf[0]|(buf[1] << 8)) == (uint16_t)*got);
+    (*got)++;
+  }
+  while(Interface_readData(l->A,buf) != 0);
+}
+
+static void bench_loss(size_t frames)
+{
+  static const double losses[] = {0,0.01,0.05,0.10,0.20,0.30};
+
+  printf("loss: window 16, %zu x %u B, 5 ms latency, 0..3 ms reordering jitter\n",frames,BENCH_PAYLOAD);
+
+  for(size_t i = 0; i < sizeof(losses)/sizeof(losses[0]); i++)
+  {
+    sBenchLink_t l;
+    size_t       sent = 0,got = 0;
+    bool         order = true;
+
+    link_open(&l,losses[i],64);
+    while((got < frames)&&(InterfaceSim_Now(l.Sim) < 3600000*BENCH_MS))
+      link_tick(&l,&sent,frames,&got,SIZE_MAX,&order);
+
+    sInterfaceArqStats_t st;
+    uint64_t             ticks = InterfaceSim_Now(l.Sim)/BENCH_MS;
+
+    InterfaceArq_GetStats(l.Qa,&st);
+    printf("  loss %4.1f %%  %5zu/%zu frames  %6llu ticks  goodput %6.1f frames/ktick  retx %5u fast %5u  %s\n",
+           100.0*losses[i],got,frames,(unsigned long long)ticks,1000.0*(double)got/(double)ticks,
+           st.Retransmits,st.FastRetransmits,order ? "in order" : "ORDER BROKEN");
+
+    link_close(&l);
+  }
+}
+
+static void bench_slow_rx(size_t frames)
+{
+  static const size_t every[] = {1,2,4,8};
+
+  printf("slow rx: 5 %% loss, receiver CircDeep 4 reads one frame every n ticks, %zu frames\n",frames);
+
+  for(size_t i = 0; i < sizeof(every)/sizeof(every[0]); i++)
+  {
+    sBenchLink_t l;
+    size_t       sent = 0,got = 0;
+    bool         order = true;
+
+    link_open(&l,0.05,4);
+    for(uint64_t t = 0; (got < frames)&&(t < 3600000); t++)
+      link_tick(&l,&sent,frames,&got,(t%every[i] == 0) ? 1 : 0,&order);
+
+    sInterfaceRxDrops_t  drops;
+    sInterfaceArqStats_t st;
+
+    Interface_GetRxDrops(l.B,&drops);
+    InterfaceArq_GetStats(l.Qa,&st);
+    printf("  every %zu  %5zu/%zu frames  %6llu ticks  rx queue drops %u  retx %5u  %s\n",
+           every[i],got,frames,(unsigned long long)(InterfaceSim_Now(l.Sim)/BENCH_MS),drops.Dropped,
+           st.Retransmits,order ? "in order" : "ORDER BROKEN");
+
+    link_close(&l);
+  }
+}
+
+int main(int argc,char** argv)
+{
+  size_t frames = 2000;
+
+  if(argc > 1)
+    frames = strtoul(argv[1],NULL,0);
+  if(argc > 2)
+    seed = strtoull(argv[2],NULL,0);
+
+  bench_loss(frames);
+  bench_slow_rx(frames/2);
+
+  return 0;
+}
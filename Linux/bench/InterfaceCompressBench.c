@@ -0,0 +1,207 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceCompressBench.c
+ * @author   Wyrm
+ * @brief    Ratio and cost of @ref InterfaceCompress_t per payload kind
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_compress_bench [frames] [seed]
+
+  ratio/cpu - InterfaceCompress_Pack and InterfaceCompress_Unpack of
+              pre-generated frames, timed in separate loops:
+              telemetry records (4 packed sensor records, 248 B),
+              text log lines (about 107 B) and random bytes (200 B),
+              ratio of wire bytes (with flag) to payload bytes, ns per
+              payload byte, share of frames sent raw, round trip check
+  fuzz      - InterfaceCompress_Unblock of 1M random blocks, must not
+              write past the output buffer (run under a sanitizer)
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "InterfaceCompress.h"
+
+#define BENCH_MAX_FRAME 256u
+#define BENCH_POOL      1024u   /*!< Different frames per payload kind, cycled*/
+
+/**
+ * @brief Telemetry record of a sensor node
+ *
+ */
+typedef struct __attribute__((packed))
+{
+  uint16_t  Id;
+  uint32_t  Ts;
+  int16_t   Acc[3];
+  int16_t   Gyr[3];
+  int16_t   Mag[3];
+  uint16_t  Status;
+  float     Temp;
+  int32_t   Pos[4];
+  uint8_t   Flags[16];
+}sBenchRecord_t;
+
+static uint64_t seed = 1;
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+static uint32_t rnd(void)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  return (uint32_t)(seed >> 32);
+}
+
+static size_t gen_telemetry(uint8_t* buf,size_t i)
+{
+  sBenchRecord_t rec[4];
+
+  memset(rec,0,sizeof(rec));
+  for(size_t k = 0; k < 4; k++)
+  {
+    rec[k].Id = (uint16_t)(0x100+k);
+    rec[k].Ts = (uint32_t)(1000*i+k);
+    for(size_t j = 0; j < 3; j++)
+    {
+      rec[k].Acc[j] = (int16_t)(100+rnd()%5);
+      rec[k].Gyr[j] = (int16_t)(rnd()%3)-1;
+      rec[k].Mag[j] = 300;
+    }
+    rec[k].Status = 1;
+    rec[k].Temp   = 25.5f;
+    rec[k].Pos[0] = (int32_t)i;
+  }
+  memcpy(buf,rec,sizeof(rec));
+  return sizeof(rec);
+}
+
+static size_t gen_log(uint8_t* buf,size_t i)
+{
+  return (size_t)snprintf((char*)buf,BENCH_MAX_FRAME-8,
+                          "[%08zu] INFO  sensor %zu: temp=25.%zu C volt=3.30 V status=OK link=UP rssi=-%zu dBm queue=%zu/64 frames=%zu",
+                          i*10,i%4,i%10,60+i%7,i%64,i*13);
+}
+
+static size_t gen_random(uint8_t* buf,size_t i)
+{
+  (void)i;
+  for(size_t k = 0; k < 200; k++)
+    buf[k] = (uint8_t)rnd();
+  return 200;
+}
+
+static const struct
+{
+  const char* Name;
+  size_t      (*Gen)(uint8_t* buf,size_t i);
+}kinds[] =
+{
+  {"telemetry records",gen_telemetry},
+  {"text log lines",gen_log},
+  {"random",gen_random},
+};
+
+static void bench_ratio(size_t frames)
+{
+  static uint8_t src[BENCH_POOL][BENCH_MAX_FRAME];
+  static uint8_t wire[BENCH_POOL][BENCH_MAX_FRAME+8];
+  static size_t  src_len[BENCH_POOL];
+  static size_t  wire_len[BENCH_POOL];
+
+  printf("ratio/cpu: %zu frames per kind, pack and unpack timed apart\n",frames);
+
+  for(size_t k = 0; k < sizeof(kinds)/sizeof(kinds[0]); k++)
+  {
+    InterfaceCompress_t* c = InterfaceCompress_ctor(BENCH_MAX_FRAME);
+    size_t               in = 0,out = 0,ok = 0,len = 0;
+    uint8_t*             p;
+
+    for(size_t i = 0; i < BENCH_POOL; i++)
+    {
+      src_len[i]  = kinds[k].Gen(src[i],i);
+      wire_len[i] = InterfaceCompress_Pack(c,&p,src[i],src_len[i]);
+      memcpy(wire[i],p,wire_len[i]);
+    }
+
+    uint64_t tp = now_ns();
+    for(size_t i = 0; i < frames; i++)
+      out += InterfaceCompress_Pack(c,&p,src[i%BENCH_POOL],src_len[i%BENCH_POOL]);
+    tp = now_ns()-tp;
+
+    uint64_t tu = now_ns();
+    for(size_t i = 0; i < frames; i++)
+      len += InterfaceCompress_Unpack(c,&p,wire[i%BENCH_POOL],wire_len[i%BENCH_POOL]);
+    tu = now_ns()-tu;
+
+    for(size_t i = 0; i < frames; i++)
+      in += src_len[i%BENCH_POOL];
+    for(size_t i = 0; i < BENCH_POOL; i++)
+      ok += (InterfaceCompress_Unpack(c,&p,wire[i],wire_len[i]) == src_len[i])&&(memcmp(p,src[i],src_len[i]) == 0);
+
+    sInterfaceCompressStats_t st;
+    InterfaceCompress_GetStats(c,&st);
+
+    printf("  %-18s %3zu B  ratio %.2f  pack %5.2f ns/B  unpack %5.2f ns/B  raw %5.1f %%  %s\n",
+           kinds[k].Name,in/frames,(double)out/(double)in,(double)tp/(double)in,(double)tu/(double)in,
+           100.0*st.TxRaw/(double)st.TxFrames,((ok == BENCH_POOL)&&(len == in)) ? "ok" : "FAILED");
+
+    InterfaceCompress_dtor(c);
+  }
+}
+
+static void bench_fuzz(size_t blocks)
+{
+  uint8_t blk[64];
+  uint8_t out[BENCH_MAX_FRAME];
+  size_t  decoded = 0;
+
+  for(size_t i = 0; i < blocks; i++)
+  {
+    size_t len = rnd()%sizeof(blk);
+
+    for(size_t k = 0; k < len; k++)
+      blk[k] = (uint8_t)rnd();
+    decoded += (InterfaceCompress_Unblock(out,sizeof(out),blk,len) != 0);
+  }
+
+  printf("fuzz: %zu random blocks, %zu decoded, %zu rejected\n",blocks,decoded,blocks-decoded);
+}
+
+int main(int argc,char** argv)
+{
+  size_t frames = 200000;
+
+  if(argc > 1)
+    frames = strtoul(argv[1],NULL,0);
+  if(argc > 2)
+    seed = strtoull(argv[2],NULL,0);
+  if(seed == 0)
+    seed = 1;
+
+  bench_ratio(frames);
+  bench_fuzz(1000000);
+
+  return 0;
+}
@@ -0,0 +1,299 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceCoroBench.cpp
+ * @author   Wyrm
+ * @brief    Coroutine conversations (@ref InterfaceCoro.hpp) against thread per conversation
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_coro_bench [conversations] [requests]
+
+  Every conversation sends requests keyed by its id and waits for the echo
+  over an @ref InterfaceSim_t link (100 us latency, virtual time), the echo
+  server runs on the other end.
+  threads - a thread per conversation blocked on its condition variable, one
+            io thread polls the link and wakes the owner of each reply
+  coro    - a coroutine per conversation on one @ref InterfaceExecutor
+  wall time, requests/s, threads and context switches are printed, the
+  thread run is skipped above 2000 conversations
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <ctime>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <sys/resource.h>
+
+#include "Interface.h"
+#include "InterfaceCoro.hpp"
+#include "InterfaceSim.h"
+
+#define BENCH_MS      1000000ull
+#define BENCH_FRAME   64u
+#define BENCH_REQ     16u
+#define BENCH_THREADS 2000u
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+static long switches(void)
+{
+  struct rusage ru;
+  getrusage(RUSAGE_SELF,&ru);
+  return ru.ru_nvcsw+ru.ru_nivcsw;
+}
+
+/**
+ * @brief Link under test, end 0 - conversations, end 1 - echo server
+ *
+ */
+struct BenchLink
+{
+  InterfaceSim_t*     Sim;
+  InterfaceHandel_t*  A;
+  InterfaceHandel_t*  B;
+  uint8_t             Echo[BENCH_FRAME];   /*!< reply the server could not queue yet*/
+  size_t              EchoLeng = 0;
+
+  BenchLink()
+  {
+    sInterfaceSimCfg_t cfg = {};
+
+    cfg.MaxFrame = BENCH_FRAME;
+    cfg.Deep     = 16384;
+    cfg.TickNs   = BENCH_MS;
+    cfg.Seed     = 1;
+    cfg.Path[0].LatencyNs = 100000;
+    cfg.Path[1]  = cfg.Path[0];
+
+    Sim = InterfaceSim_ctor(&cfg);
+    A   = Interface_ctor(InterfaceSim_GetHw(Sim,0),BENCH_FRAME,256);
+    B   = Interface_ctor(InterfaceSim_GetHw(Sim,1),BENCH_FRAME,256);
+  }
+
+  ~BenchLink()
+  {
+    Interface_dtor(A);
+    Interface_dtor(B);
+    InterfaceSim_dtor(Sim);
+  }
+
+  /** @brief Echo server step, true if it moved a frame*/
+  bool serve()
+  {
+    bool active = Interface_poll(B);
+
+    for(;;)
+    {
+      if(EchoLeng == 0)
+        EchoLeng = Interface_readData(B,Echo);
+      if((EchoLeng == 0)||!Interface_SendData(B,Echo,EchoLeng))
+        break;
+      EchoLeng = 0;
+      active   = true;
+    }
+    return active;
+  }
+};
+
+static void put_request(uint8_t* cmd,size_t id,size_t seq)
+{
+  memset(cmd,0,BENCH_FRAME);
+  cmd[0] = (uint8_t)id;
+  cmd[1] = (uint8_t)(id >> 8);
+  cmd[2] = (uint8_t)seq;
+}
+
+static void report(const char* name,size_t conv,size_t req,size_t done,size_t threads,uint64_t wall,long csw)
+{
+  printf("  %-7s %6zu conversations  %8zu/%zu replies  %8.1f ms  %9.0f req/s  threads %5zu  ctx switches %8ld\n",
+         name,conv,done,conv*req,wall/1e6,(double)done*1e9/(double)wall,threads,csw);
+}
+
+/* thread per conversation ---------------------------------------------------*/
+
+struct ThreadConv
+{
+  std::condition_variable Cv;
+  bool                    Ready = false;
+  uint8_t                 Reply[BENCH_FRAME];
+};
+
+static void bench_threads(size_t conv,size_t req)
+{
+  BenchLink               link;
+  std::mutex              lock;
+  std::condition_variable txcv;
+  std::vector<ThreadConv> convs(conv);
+  size_t                  done = 0;
+  bool                    stop = false;
+  long                    csw  = switches();
+  uint64_t                wall = now_ns();
+
+  std::thread io([&]
+  {
+    uint8_t buf[BENCH_FRAME];
+    std::unique_lock<std::mutex> lk(lock);
+
+    while(!stop)
+    {
+      bool   active = Interface_poll(link.A);
+      size_t len;
+
+      while((len = Interface_readData(link.A,buf)) != 0)
+      {
+        ThreadConv& c = convs[buf[0]|(buf[1] << 8)];
+        memcpy(c.Reply,buf,len);
+        c.Ready = true;
+        c.Cv.notify_one();
+        active  = true;
+      }
+      active |= link.serve();
+      txcv.notify_all();
+
+      if(active)
+        continue;
+
+      if(!InterfaceSim_IsIdle(link.Sim))
+        InterfaceSim_Advance(link.Sim,BENCH_MS);
+      else
+      {
+        /* nothing in flight, let the conversations send*/
+        lk.unlock();
+        std::this_thread::yield();
+        lk.lock();
+      }
+    }
+  });
+
+  std::vector<std::thread> threads;
+
+  for(size_t id = 0; id < conv; id++)
+  {
+    threads.emplace_back([&,id]
+    {
+      uint8_t     cmd[BENCH_FRAME+4];
+      ThreadConv& c = convs[id];
+
+      for(size_t seq = 0; seq < req; seq++)
+      {
+        std::unique_lock<std::mutex> lk(lock);
+
+        put_request(cmd,id,seq);
+        c.Ready = false;
+        txcv.wait(lk,[&]{ return Interface_SendData(link.A,cmd,BENCH_FRAME); });
+        c.Cv.wait(lk,[&]{ return c.Ready; });
+        done += (c.Reply[2] == (uint8_t)seq);
+      }
+    });
+  }
+
+  for(std::thread& t : threads)
+    t.join();
+  {
+    std::lock_guard<std::mutex> lk(lock);
+    stop = true;
+  }
+  io.join();
+
+  report("threads",conv,req,done,conv+1,now_ns()-wall,switches()-csw);
+}
+
+/* coroutine per conversation ------------------------------------------------*/
+
+struct CoroBench
+{
+  BenchLink       Link;
+  size_t          Done = 0;
+
+  static void idle(void* parent)
+  {
+    CoroBench* b = static_cast<CoroBench*>(parent);
+
+    if(!b->Link.serve())
+      InterfaceSim_Advance(b->Link.Sim,BENCH_MS);
+  }
+};
+
+static InterfaceTask<> conversation(InterfaceCoLink& link,size_t id,size_t req,size_t& done)
+{
+  uint8_t cmd[BENCH_FRAME+4];
+  uint8_t reply[BENCH_FRAME];
+
+  for(size_t seq = 0; seq < req; seq++)
+  {
+    put_request(cmd,id,seq);
+    if(co_await link.request(cmd,BENCH_FRAME,reply,10000) != 0)
+      done += (reply[2] == (uint8_t)seq);
+  }
+}
+
+static void bench_coro(size_t conv,size_t req)
+{
+  CoroBench                 bench;
+  const sInterfaceClock_t   clock = {bench.Link.Sim,InterfaceSim_Tick};
+  const sInterfaceNotify_t  idle  = {&bench,CoroBench::idle};
+  const sInterfaceKeyField_t key  = {0,2,false};
+  InterfaceExecutor         exec(clock);
+  long                      csw  = switches();
+  uint64_t                  wall = now_ns();
+
+  exec.set_idle(idle);
+  {
+    InterfaceCoLink link(exec,bench.Link.A,&key);
+
+    for(size_t id = 0; id < conv; id++)
+      exec.spawn(conversation(link,id,req,bench.Done));
+    exec.run();
+  }
+
+  report("coro",conv,req,bench.Done,1,now_ns()-wall,switches()-csw);
+}
+
+int main(int argc,char** argv)
+{
+  size_t conv[] = {100,1000,10000};
+  size_t req    = BENCH_REQ;
+  size_t n      = sizeof(conv)/sizeof(conv[0]);
+
+  if(argc > 1)
+  {
+    conv[0] = strtoul(argv[1],NULL,0);
+    n       = 1;
+  }
+  if(argc > 2)
+    req = strtoul(argv[2],NULL,0);
+
+  printf("coro: %zu requests of %u B per conversation, 100 us link, echo server\n",req,BENCH_FRAME);
+
+  for(size_t i = 0; i < n; i++)
+  {
+    if(conv[i] > 65536)
+      continue;
+    if(conv[i] <= BENCH_THREADS)
+      bench_threads(conv[i],req);
+    bench_coro(conv[i],req);
+  }
+
+  return 0;
+}
@@ -0,0 +1,310 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceMpscBench.c
+ * @author   Wyrm
+ * @brief    Multi-producer tx queue stress in irq mode (@ref Interface_SetMultiProducer)
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_mpsc_bench [rounds] [producers]
+
+  Interface in kInterfaceRxTx_irq mode over a driver whose tx complete irq
+  is a thread, Tx critical section is a mutex that holds that thread off.
+  Every round each producer sends a burst with Interface_TxReserve and
+  Interface_TxCommit, so commits land out of reservation order:
+  - some reservations are taken in pairs and the second one is committed first
+  - commit follows the reservation after a random spin
+  The link must drain by itself. Frames left in the queue with the driver
+  idle for 5 ms are a lost wakeup ("stalls", must be 0), the bench then
+  kicks the queue from the tx irq side so producers blocked on a full queue
+  can go on.
+  The driver checks that frames of each producer leave in reservation order.
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+
+#include "Interface.h"
+#include "InterfacePrivate.h"
+
+#define BENCH_MAX_FRAME     32u
+#define BENCH_MAX_PRODUCERS 16u
+#define BENCH_BURST         8u
+#define BENCH_DEEP          8u
+#define BENCH_STALL_NS      5000000ull
+
+/**
+ * @brief Driver with tx complete irq thread
+ *
+ */
+typedef struct
+{
+  HWInterface_t         base;
+  HwInterface_vtable_t  vtable;
+  pthread_mutex_t       Irq;        /*!< held by Tx critical section and by the irq*/
+  atomic_bool           Busy;       /*!< frame on the line*/
+  atomic_bool           Stop;
+  atomic_size_t         Frames;     /*!< frames taken by SendData*/
+  uint32_t              Next[BENCH_MAX_PRODUCERS];
+  bool                  Order;
+}sBenchHw_t;
+
+/**
+ * @brief Producer thread
+ *
+ */
+typedef struct
+{
+  InterfaceHandel_t*  iface;
+  pthread_barrier_t*  bar;
+  atomic_size_t*      Done;     /*!< bursts finished by all producers*/
+  size_t              Id;
+  size_t              Rounds;
+  uint32_t            Seq;
+  uint32_t            Rnd;
+}sBenchProducer_t;
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+static void hw_set(void* hw,uint8_t* data,size_t len)  {(void)hw;(void)data;(void)len;}
+static void hw_nop(void* hw)                            {(void)hw;}
+static bool hw_true(void* hw)                           {(void)hw;return true;}
+static size_t hw_max(void* hw)                          {(void)hw;return BENCH_MAX_FRAME;}
+static void hw_lock(void* hw)                           {pthread_mutex_lock(&((sBenchHw_t*)hw)->Irq);}
+static void hw_unlock(void* hw)
+{
+  pthread_mutex_unlock(&((sBenchHw_t*)hw)->Irq);
+  /* leaving a critical section may switch task (RTOS), another producer
+     commits and kicks before the kick guard is cleared*/
+  sched_yield();
+}
+
+static bool hw_free(void* hw)                           {return !atomic_load(&((sBenchHw_t*)hw)->Busy);}
+static bool hw_read(void* hw,uint8_t* data,size_t* len,size_t max_len) {(void)hw;(void)data;(void)len;(void)max_len;return false;}
+
+static bool hw_send(void* hw,const uint8_t* data,size_t len)
+{
+  sBenchHw_t* cthis = hw;
+  uint32_t    seq;
+
+  if(atomic_load(&cthis->Busy)||(len != 1+sizeof(seq))||(data[0] >= BENCH_MAX_PRODUCERS))
+    return false;
+
+  memcpy(&seq,data+1,sizeof(seq));
+  cthis->Order &= (seq == cthis->Next[data[0]]);
+  cthis->Next[data[0]] = seq+1;
+
+  atomic_store(&cthis->Busy,true);
+  atomic_fetch_add(&cthis->Frames,1);
+  return true;
+}
+
+static void* hw_irq_thread(void* arg)
+{
+  sBenchHw_t* cthis = arg;
+
+  while(!atomic_load(&cthis->Stop))
+  {
+    if(!atomic_load(&cthis->Busy))
+    {
+      sched_yield();
+      continue;
+    }
+
+    pthread_mutex_lock(&cthis->Irq);
+    atomic_store(&cthis->Busy,false);
+    cthis->vtable.irqcb->tx_cb(cthis->vtable.irqcb->parent);
+    pthread_mutex_unlock(&cthis->Irq);
+  }
+  return NULL;
+}
+
+static void hw_init(sBenchHw_t* hw)
+{
+  memset(hw,0,sizeof(*hw));
+  hw->vtable.SetRxBuff       = hw_set;
+  hw->vtable.SetTxBuff       = hw_set;
+  hw->vtable.EnterCriticalRx = hw_nop;
+  hw->vtable.ExitCriticalRx  = hw_nop;
+  hw->vtable.EnterCriticalTx = hw_lock;
+  hw->vtable.ExitCriticalTx  = hw_unlock;
+  hw->vtable.Connect         = hw_true;
+  hw->vtable.Disconnect      = hw_true;
+  hw->vtable.Process         = hw_nop;
+  hw->vtable.IsFree          = hw_free;
+  hw->vtable.SendData        = hw_send;
+  hw->vtable.ReadRxBuff      = hw_read;
+  hw->vtable.GetMaxDataLeng  = hw_max;
+  hw->base.vtable            = &hw->vtable;
+  hw->Order                  = true;
+  pthread_mutex_init(&hw->Irq,NULL);
+}
+
+static uint32_t rnd(sBenchProducer_t* p)
+{
+  p->Rnd = p->Rnd*1664525u+1013904223u;
+  return p->Rnd >> 16;
+}
+
+static void spin(sBenchProducer_t* p)
+{
+  for(volatile uint32_t n = rnd(p)%512; n != 0; n--);
+}
+
+static uint8_t* reserve(sBenchProducer_t* p)
+{
+  uint8_t* slot;
+
+  while((slot = Interface_TxReserve(p->iface,1+sizeof(p->Seq))) == NULL)
+    sched_yield();
+
+  slot[0] = (uint8_t)p->Id;
+  memcpy(slot+1,&p->Seq,sizeof(p->Seq));
+  p->Seq++;
+  return slot;
+}
+
+static void* producer_thread(void* arg)
+{
+  sBenchProducer_t* p = arg;
+
+  for(size_t r = 0; r < p->Rounds; r++)
+  {
+    pthread_barrier_wait(p->bar);
+
+    for(size_t i = 0; i < BENCH_BURST; i++)
+    {
+      uint8_t* first = reserve(p);
+
+      if((rnd(p)&1) && (i+1 < BENCH_BURST))
+      {
+        /* second reservation is committed first, head waits for the first one*/
+        uint8_t* second = Interface_TxReserve(p->iface,1+sizeof(p->Seq));
+
+        if(second != NULL)
+        {
+          second[0] = (uint8_t)p->Id;
+          memcpy(second+1,&p->Seq,sizeof(p->Seq));
+          p->Seq++;
+          i++;
+          spin(p);
+          Interface_TxCommit(p->iface,second,1+sizeof(p->Seq));
+        }
+      }
+
+      spin(p);
+      Interface_TxCommit(p->iface,first,1+sizeof(p->Seq));
+    }
+
+    atomic_fetch_add(p->Done,1);
+  }
+  return NULL;
+}
+
+int main(int argc,char** argv)
+{
+  size_t rounds    = 20000;
+  size_t producers = 4;
+
+  if(argc > 1)
+    rounds = strtoul(argv[1],NULL,0);
+  if(argc > 2)
+    producers = strtoul(argv[2],NULL,0);
+  if((producers == 0)||(producers > BENCH_MAX_PRODUCERS))
+    producers = 4;
+
+  static sBenchHw_t  hw;
+  sBenchProducer_t   prod[BENCH_MAX_PRODUCERS];
+  pthread_t          threads[BENCH_MAX_PRODUCERS];
+  pthread_t          irq;
+  pthread_barrier_t  bar;
+  atomic_size_t      done = 0;
+
+  hw_init(&hw);
+
+  InterfaceHandel_t* iface = Interface_ctor(&hw.base,BENCH_MAX_FRAME,4);
+
+  Interface_SetRawMode(iface,true);
+  Interface_SetMultiProducer(iface,BENCH_DEEP);
+  Interface_SetMode(iface,kInterfaceRxTx_irq);
+
+  pthread_barrier_init(&bar,NULL,(unsigned)producers+1);
+  pthread_create(&irq,NULL,hw_irq_thread,&hw);
+  for(size_t i = 0; i < producers; i++)
+  {
+    prod[i] = (sBenchProducer_t){.iface = iface,.bar = &bar,.Done = &done,.Id = i,.Rounds = rounds,.Rnd = (uint32_t)(i*7919+1)};
+    pthread_create(&threads[i],NULL,producer_thread,&prod[i]);
+  }
+
+  size_t   stalled = 0;
+  uint64_t wall    = now_ns();
+
+  for(size_t r = 0; r < rounds; r++)
+  {
+    pthread_barrier_wait(&bar);
+
+    size_t   total = (r+1)*producers*BENCH_BURST;
+    size_t   last  = atomic_load(&hw.Frames);
+    uint64_t start = now_ns();
+
+    while((atomic_load(&done) < (r+1)*producers)||(atomic_load(&hw.Frames) < total))
+    {
+      if(atomic_load(&hw.Frames) != last)
+      {
+        last  = atomic_load(&hw.Frames);
+        start = now_ns();
+      }
+      else if(now_ns()-start > BENCH_STALL_NS)
+      {
+        /* driver idle under the Tx lock means nothing in flight, a frame
+           sent by this kick was committed and left waiting*/
+        pthread_mutex_lock(&hw.Irq);
+        if(!atomic_load(&hw.Busy))
+        {
+          hw.vtable.irqcb->tx_cb(hw.vtable.irqcb->parent);
+          stalled += (atomic_load(&hw.Frames) != last);
+        }
+        pthread_mutex_unlock(&hw.Irq);
+        start = now_ns();
+      }
+      sched_yield();
+    }
+  }
+  wall = now_ns()-wall;
+
+  for(size_t i = 0; i < producers; i++)
+    pthread_join(threads[i],NULL);
+  atomic_store(&hw.Stop,true);
+  pthread_join(irq,NULL);
+
+  printf("mpsc irq: %zu producers x %zu rounds x %u frames, deep %u\n",producers,rounds,BENCH_BURST,BENCH_DEEP);
+  printf("  sent %zu  stalls %zu  order %s  %.0f ns/frame\n",
+         atomic_load(&hw.Frames),stalled,hw.Order ? "ok" : "BROKEN",
+         (double)wall/(double)atomic_load(&hw.Frames));
+
+  Interface_dtor(iface);
+
+  return ((stalled == 0)&&hw.Order) ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceReplayBench.c
+ * @author   Wyrm
+ * @brief    Rx path throughput on a replayed capture
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_replay_bench [-p] [-r] [-n loops] [capture]
+
+  capture - file of InterfaceCapture, without it a synthetic capture of 100k
+            random 16..256 byte chunks is written to a temp file first
+  -p      - paced replay (recorded timing), default as fast as possible
+  -r      - raw mode (no parser)
+  -n      - replay the capture n times (fast mode)
+  Frames are read back by Interface_readData, every run reports chunks/s, MB/s
+  and ns per chunk of the whole rx path.
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "Interface.h"
+#include "InterfaceCapture.h"
+#include "InterfaceReplay.h"
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+static bool synth(const char* path,size_t chunks)
+{
+  InterfaceCapture_t* cap = InterfaceCapture_ctor(path,1u << 20);
+  uint8_t             buf[256];
+
+  if(cap == NULL)
+    return false;
+
+  for(size_t i = 0; i < chunks; i++)
+  {
+    size_t len = 16+(size_t)rand()%(sizeof(buf)-15);
+
+    for(size_t k = 0; k < len; k++)
+      buf[k] = (uint8_t)rand();
+    InterfaceCapture_Write(cap,buf,len);
+  }
+
+  bool state = (InterfaceCapture_GetLost(cap) == 0);
+  InterfaceCapture_dtor(cap);
+  return state;
+}
+
+int main(int argc,char** argv)
+{
+  bool        paced = false,raw = false;
+  unsigned    loops = 5;
+  const char* path  = NULL;
+  char        tmp[] = "/tmp/interface_capture_XXXXXX";
+  int         opt;
+
+  while((opt = getopt(argc,argv,"prn:")) != -1)
+  {
+    switch(opt)
+    {
+      case 'p': paced = true;                             break;
+      case 'r': raw   = true;                             break;
+      case 'n': loops = (unsigned)strtoul(optarg,NULL,0); break;
+      default:
+        fprintf(stderr,"usage: %s [-p] [-r] [-n loops] [capture]\n",argv[0]);
+        return 1;
+    }
+  }
+
+  if(optind < argc)
+    path = argv[optind];
+  else
+  {
+    int fd = mkstemp(tmp);
+    if(fd < 0)
+      return 1;
+    close(fd);
+    unlink(tmp); /* capture writes header to new file only*/
+    if(!synth(tmp,100000))
+      return 1;
+    path = tmp;
+  }
+
+  InterfaceReplay_t* rp = InterfaceReplay_ctor(path,paced);
+  if(rp == NULL)
+  {
+    fprintf(stderr,"%s: not a capture file\n",path);
+    return 1;
+  }
+
+  InterfaceHandel_t* iface = Interface_ctor(InterfaceReplay_GetHw(rp),InterfaceReplay_GetMaxChunk(rp),64);
+  uint8_t*           out   = malloc(InterfaceReplay_GetMaxChunk(rp)+1);
+
+  Interface_SetRawMode(iface,raw);
+
+  for(unsigned run = 0; run < (paced ? 1u : loops); run++)
+  {
+    sInterfaceReplayStats_t s0,s1;
+    uint64_t                frames = 0;
+
+    InterfaceReplay_Rewind(rp);
+    InterfaceReplay_GetStats(rp,&s0);
+    uint64_t t0 = now_ns();
+
+    while(!InterfaceReplay_IsDone(rp)||Interface_isRxNe(iface))
+    {
+      Interface_process(iface);
+      while(Interface_readData(iface,out))
+        frames++;
+    }
+
+    uint64_t dt = now_ns()-t0;
+    InterfaceReplay_GetStats(rp,&s1);
+
+    uint64_t chunks = s1.Chunks-s0.Chunks;
+    printf("run %u: %8llu chunks %8llu frames  %7.2f Mchunk/s  %8.1f MB/s  %6.1f ns/chunk\n",
+           run,(unsigned long long)chunks,(unsigned long long)frames,
+           chunks*1e3/(double)dt,(s1.Bytes-s0.Bytes)*1e3/(double)dt,(double)dt/(double)(chunks ? chunks : 1));
+  }
+
+  free(out);
+  Interface_dtor(iface);
+  InterfaceReplay_dtor(rp);
+  if(path == tmp)
+    unlink(tmp);
+
+  return 0;
+}
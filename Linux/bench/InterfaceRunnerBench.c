@@ -0,0 +1,263 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceRunnerBench.c
+ * @author   Wyrm
+ * @brief    Idle cpu and wake-up latency of @ref InterfaceRunner_t policies
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_runner_bench [frames]
+
+  Two interfaces over an AF_UNIX SOCK_SEQPACKET pair. Frames carry a send time
+  stamp and are sent with random 0.2..2 ms gaps.
+  rx: receiver runner sleeps on the socket fd, latency = rx callback - send
+  tx: sender driver is "busy" outside its runner, so frames are queued and
+      the runner is woken by tx notify, latency = peer rx callback - send
+  cpu% is runner thread cpu time / wall time
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "Interface.h"
+#include "InterfacePrivate.h"
+#include "InterfaceRunner.h"
+
+#define BENCH_MAX_FRAME  64u
+
+/**
+ * @brief Socket driver
+ *
+ */
+typedef struct
+{
+  HWInterface_t         base;
+  HwInterface_vtable_t  vtable;
+  int                   fd;
+  bool                  DeferTx;  /*!< SendData fails outside runner thread*/
+}sBenchHw_t;
+
+/**
+ * @brief One side of the bench
+ *
+ */
+typedef struct
+{
+  sBenchHw_t          hw;
+  InterfaceHandel_t*  iface;
+  InterfaceRunner_t*  runner;
+  pthread_t           thread;
+  uint64_t*           lat;      /*!< rx latencies, ns*/
+  size_t              cnt;
+}sBenchNode_t;
+
+static __thread bool in_runner;
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+static void hw_set(void* hw,uint8_t* data,size_t len)  {(void)hw;(void)data;(void)len;}
+static void hw_nop(void* hw)                            {(void)hw;}
+static bool hw_true(void* hw)                           {(void)hw;return true;}
+static size_t hw_max(void* hw)                          {(void)hw;return BENCH_MAX_FRAME;}
+
+static bool hw_send(void* hw,const uint8_t* data,size_t len)
+{
+  sBenchHw_t* cthis = hw;
+
+  if(cthis->DeferTx && !in_runner)
+    return false;
+  return send(cthis->fd,data,len,MSG_DONTWAIT) == (ssize_t)len;
+}
+
+static bool hw_read(void* hw,uint8_t* data,size_t* len,size_t max_len)
+{
+  ssize_t ret = recv(((sBenchHw_t*)hw)->fd,data,max_len,MSG_DONTWAIT);
+
+  if(ret <= 0)
+    return false;
+  *len = (size_t)ret;
+  return true;
+}
+
+static void hw_init(sBenchHw_t* hw,int fd,bool defer)
+{
+  memset(hw,0,sizeof(*hw));
+  hw->vtable.SetRxBuff       = hw_set;
+  hw->vtable.SetTxBuff       = hw_set;
+  hw->vtable.EnterCriticalRx = hw_nop;
+  hw->vtable.ExitCriticalRx  = hw_nop;
+  hw->vtable.EnterCriticalTx = hw_nop;
+  hw->vtable.ExitCriticalTx  = hw_nop;
+  hw->vtable.Connect         = hw_true;
+  hw->vtable.Disconnect      = hw_true;
+  hw->vtable.Process         = hw_nop;
+  hw->vtable.IsFree          = hw_true;
+  hw->vtable.SendData        = hw_send;
+  hw->vtable.ReadRxBuff      = hw_read;
+  hw->vtable.GetMaxDataLeng  = hw_max;
+  hw->base.vtable            = &hw->vtable;
+  hw->fd                     = fd;
+  hw->DeferTx                = defer;
+}
+
+static void node_rx(void* parent,InterfaceHandel_t* iface,uint8_t* data,size_t len)
+{
+  sBenchNode_t* node = parent;
+  uint64_t      ts;
+
+  (void)iface;
+  if(len < sizeof(ts))
+    return;
+  memcpy(&ts,data,sizeof(ts));
+  node->lat[node->cnt++] = now_ns()-ts;
+}
+
+static void node_none(void* parent,InterfaceHandel_t* iface) {(void)parent;(void)iface;}
+
+static void* node_thread(void* arg)
+{
+  in_runner = true;
+  InterfaceRunner_Run(((sBenchNode_t*)arg)->runner);
+  return NULL;
+}
+
+static bool node_init(sBenchNode_t* node,int fd,bool defer,const sInterfaceRunnerCfg_t* cfg,size_t frames)
+{
+  hw_init(&node->hw,fd,defer);
+
+  if((node->iface = Interface_ctor(&node->hw.base,BENCH_MAX_FRAME,16)) == NULL)
+    return false;
+
+  sInterfaceIrqParentCB_t cb = {.parent = node,.RxCb = node_rx,.TxCb = node_none,.ErrCb = node_none};
+  sInterfaceRunnerCfg_t   rcfg = *cfg;
+
+  Interface_SetRawMode(node->iface,true);
+  Interface_SetCB(node->iface,&cb);
+  Interface_SetCutThrough(node->iface,true);
+
+  if(rcfg.WaitFd >= 0)
+    rcfg.WaitFd = fd;
+  node->runner = InterfaceRunner_ctor(node->iface,&rcfg);
+  node->lat    = calloc(frames,sizeof(uint64_t));
+  node->cnt    = 0;
+
+  return (node->runner != NULL)&&(node->lat != NULL)
+       &&(pthread_create(&node->thread,NULL,node_thread,node) == 0);
+}
+
+static void node_stop(sBenchNode_t* node,sInterfaceRunnerStats_t* stats)
+{
+  InterfaceRunner_Stop(node->runner);
+  pthread_join(node->thread,NULL);
+  InterfaceRunner_GetStats(node->runner,stats);
+}
+
+static void node_deinit(sBenchNode_t* node)
+{
+  InterfaceRunner_dtor(node->runner);
+  Interface_dtor(node->iface);
+  free(node->lat);
+}
+
+static int cmp_u64(const void* a,const void* b)
+{
+  uint64_t x = *(const uint64_t*)a,y = *(const uint64_t*)b;
+  return (x > y)-(x < y);
+}
+
+static void report(const char* name,const char* dir,sBenchNode_t* rx,const sInterfaceRunnerStats_t* st)
+{
+  if(rx->cnt == 0)
+  {
+    printf("%-10s %-3s no frames\n",name,dir);
+    return;
+  }
+  qsort(rx->lat,rx->cnt,sizeof(uint64_t),cmp_u64);
+  printf("%-10s %-3s frames %5zu  p50 %7.1f us  p99 %7.1f us  max %8.1f us  cpu %5.1f %%  sleeps %7llu\n",
+         name,dir,rx->cnt,
+         rx->lat[rx->cnt/2]/1e3,rx->lat[rx->cnt*99/100]/1e3,rx->lat[rx->cnt-1]/1e3,
+         st->RunNs ? 100.0*(double)st->CpuNs/(double)st->RunNs : 0.0,
+         (unsigned long long)st->Sleeps);
+}
+
+static void run_case(const char* name,const sInterfaceRunnerCfg_t* cfg,size_t frames)
+{
+  static const sInterfaceRunnerCfg_t spin = {.SpinUs = UINT32_MAX,.SleepMinUs = 1,.SleepMaxUs = 1,.WaitFd = -1};
+
+  for(int dir = 0; dir < 2; dir++)
+  {
+    int sv[2];
+    if(socketpair(AF_UNIX,SOCK_SEQPACKET,0,sv) != 0)
+      return;
+
+    sBenchNode_t tx,rx;
+    /* rx case: policy under test on receiver; tx case: on sender, receiver spins*/
+    if(!node_init(&tx,sv[0],dir == 1,(dir == 1) ? cfg : &spin,1)
+     ||!node_init(&rx,sv[1],false,(dir == 0) ? cfg : &spin,frames))
+      exit(1);
+
+    for(size_t i = 0; i < frames; i++)
+    {
+      struct timespec gap = {.tv_sec = 0,.tv_nsec = 200000+rand()%1800000};
+      nanosleep(&gap,NULL);
+
+      uint8_t  frame[16] = {0};
+      uint64_t ts = now_ns();
+      memcpy(frame,&ts,sizeof(ts));
+      Interface_SendData(tx.iface,frame,sizeof(frame));
+    }
+    usleep(20000);
+
+    sInterfaceRunnerStats_t st_tx,st_rx;
+    node_stop(&tx,&st_tx);
+    node_stop(&rx,&st_rx);
+    report(name,dir ? "tx" : "rx",&rx,dir ? &st_tx : &st_rx);
+    node_deinit(&tx);
+    node_deinit(&rx);
+    close(sv[0]);
+    close(sv[1]);
+  }
+}
+
+int main(int argc,char** argv)
+{
+  size_t frames = (argc > 1) ? strtoul(argv[1],NULL,0) : 2000;
+
+  static const struct
+  {
+    const char*           name;
+    sInterfaceRunnerCfg_t cfg;
+  }cases[] = {
+    {"spin",     {.SpinUs = UINT32_MAX,.SleepMinUs = 1,   .SleepMaxUs = 1,   .WaitFd = -1}},
+    {"adaptive", {.SpinUs = 50,        .SleepMinUs = 50,  .SleepMaxUs = 5000,.WaitFd = 0}},
+    {"fd-wait",  {.SpinUs = 0,         .SleepMinUs = 5000,.SleepMaxUs = 5000,.WaitFd = 0}},
+    {"sleep-1ms",{.SpinUs = 0,         .SleepMinUs = 1000,.SleepMaxUs = 1000,.WaitFd = -1}},
+  };
+
+  for(size_t i = 0; i < sizeof(cases)/sizeof(cases[0]); i++)
+    run_case(cases[i].name,&cases[i].cfg,frames);
+
+  return 0;
+}
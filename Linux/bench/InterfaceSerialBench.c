@@ -0,0 +1,168 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceSerialBench.c
+ * @author   Wyrm
+ * @brief    Syscalls per frame of @ref InterfaceSerial_t over a pty pair
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_serial_bench [frames]
+
+  Two raw mode interfaces on the master and slave side of openpty(). Frames are
+  '\n' terminated text of 16..120 bytes, sent in bursts, both sides are polled
+  in one thread until the burst is received and checked. Every case reports
+  tx and rx syscalls per frame and frames/s, with and without CoalesceTx.
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <pty.h>
+
+#include "Interface.h"
+#include "InterfaceSerial.h"
+
+#define BENCH_MAX_FRAME  128u
+
+typedef struct
+{
+  size_t  cnt;      /*!< frames received*/
+  size_t  bad;      /*!< frames not matching sent pattern*/
+}sBenchRx_t;
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+static size_t make_frame(uint8_t* buf,size_t seq)
+{
+  size_t len = 16+seq%105;
+
+  for(size_t i = 0; i < len-1; i++)
+    buf[i] = (uint8_t)('A'+(seq+i)%26);
+  buf[len-1] = '\n';
+  return len;
+}
+
+static void node_rx(void* parent,InterfaceHandel_t* iface,uint8_t* data,size_t len)
+{
+  sBenchRx_t* rx = parent;
+  uint8_t     ref[BENCH_MAX_FRAME];
+
+  (void)iface;
+  if((make_frame(ref,rx->cnt) != len)||(memcmp(ref,data,len) != 0))
+    rx->bad++;
+  rx->cnt++;
+}
+
+static void node_none(void* parent,InterfaceHandel_t* iface) {(void)parent;(void)iface;}
+
+static void run_case(size_t burst,bool coalesce,size_t frames)
+{
+  int master,slave;
+
+  if(openpty(&master,&slave,NULL,NULL,NULL) != 0)
+  {
+    perror("openpty");
+    exit(1);
+  }
+
+  sInterfaceSerialCfg_t cfg = {
+    .Baud = 0,.LowLatency = true,.Delim = '\n',.MaxFrame = BENCH_MAX_FRAME,
+    .RxRing = 1u << 16,.TxRing = 1u << 16,.CoalesceTx = coalesce,
+  };
+  InterfaceSerial_t* stx = InterfaceSerial_ctorFd(master,&cfg);
+  InterfaceSerial_t* srx = InterfaceSerial_ctorFd(slave,&cfg);
+
+  if((stx == NULL)||(srx == NULL))
+    exit(1);
+
+  InterfaceHandel_t* tx = Interface_ctor(InterfaceSerial_GetHw(stx),BENCH_MAX_FRAME,64);
+  InterfaceHandel_t* rx = Interface_ctor(InterfaceSerial_GetHw(srx),BENCH_MAX_FRAME,64);
+  sBenchRx_t         got = {0};
+
+  if((tx == NULL)||(rx == NULL))
+    exit(1);
+
+  sInterfaceIrqParentCB_t cb = {.parent = &got,.RxCb = node_rx,.TxCb = node_none,.ErrCb = node_none};
+  Interface_SetRawMode(tx,true);
+  Interface_SetRawMode(rx,true);
+  Interface_SetCB(rx,&cb);
+  Interface_SetCutThrough(rx,true);
+
+  uint64_t t0   = now_ns();
+  size_t   sent = 0;
+
+  while(got.cnt < frames)
+  {
+    for(size_t i = 0; (i < burst)&&(sent < frames); i++)
+    {
+      uint8_t buf[BENCH_MAX_FRAME];
+      size_t  len = make_frame(buf,sent);
+
+      if(!Interface_SendData(tx,buf,len))
+        break;
+      sent++;
+    }
+
+    uint64_t limit = now_ns()+1000000000u;
+    while((got.cnt < sent)&&(now_ns() < limit))
+    {
+      Interface_poll(tx);
+      Interface_poll(rx);
+    }
+    if(got.cnt < sent)
+    {
+      printf("burst %3zu timeout, %zu of %zu frames\n",burst,got.cnt,sent);
+      break;
+    }
+  }
+
+  uint64_t                dt = now_ns()-t0;
+  sInterfaceSerialStats_t st_tx,st_rx;
+
+  InterfaceSerial_GetStats(stx,&st_tx);
+  InterfaceSerial_GetStats(srx,&st_rx);
+
+  printf("burst %3zu coalesce %d  tx syscalls/frame %6.3f  rx syscalls/frame %6.3f"
+         "  tx again %6llu  overrun %llu  bad %zu  %8.0f frames/s\n",
+         burst,coalesce,
+         (double)st_tx.TxSyscalls/(double)frames,(double)st_rx.RxSyscalls/(double)frames,
+         (unsigned long long)st_tx.TxAgain,(unsigned long long)st_rx.RxOverrun,got.bad,
+         (double)got.cnt*1e9/(double)dt);
+
+  Interface_dtor(tx);
+  Interface_dtor(rx);
+  InterfaceSerial_dtor(stx);
+  InterfaceSerial_dtor(srx);
+}
+
+int main(int argc,char** argv)
+{
+  size_t frames = (argc > 1) ? strtoul(argv[1],NULL,0) : 20000;
+  static const size_t bursts[] = {1,8,64};
+
+  for(size_t i = 0; i < sizeof(bursts)/sizeof(bursts[0]); i++)
+  {
+    run_case(bursts[i],false,frames);
+    run_case(bursts[i],true,frames);
+  }
+  return 0;
+}
@@ -0,0 +1,195 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceShaperBench.c
+ * @author   Wyrm
+ * @brief    ARQ goodput against a slow receiver with and without tx shaper
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_shaper_bench [ticks]
+
+  Virtual time, one tick per loop. Sender and receiver run ARQ (window 16).
+  Receiver driver has a 4 frame rx fifo and takes one frame every RX_PERIOD
+  ticks, frames arriving to a full fifo are lost. Ack path is not limited.
+  Capacity = frame size / RX_PERIOD bytes per tick. Shaper rate is swept from
+  0.5 to 2 x capacity, "off" is Interface_SendData as fast as driver takes it.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "Interface.h"
+#include "InterfacePrivate.h"
+#include "InterfaceArq.h"
+
+#define BENCH_PAYLOAD   100u
+#define BENCH_FRAME     (BENCH_PAYLOAD+INTERFACE_ARQ_HEAD_SIZE)
+#define BENCH_FIFO      4u
+#define BENCH_DELAY     3u    /*!< link delay, ticks*/
+#define RX_PERIOD       4u    /*!< receiver takes one frame per RX_PERIOD ticks*/
+
+/**
+ * @brief Simulated link end
+ *
+ */
+typedef struct sBenchHw
+{
+  HWInterface_t         base;
+  HwInterface_vtable_t  vtable;
+  struct sBenchHw*      peer;
+  struct
+  {
+    uint8_t   data[2*BENCH_FRAME];
+    size_t    len;
+    uint32_t  due;
+  }fifo[256];
+  size_t                cnt;
+  size_t                depth;    /*!< rx fifo limit*/
+  uint32_t              period;   /*!< ticks between rx reads, 0 - no limit*/
+  uint32_t              next;     /*!< tick of next rx read*/
+  uint32_t              lost;
+}sBenchHw_t;
+
+static uint32_t now;
+
+static uint32_t clk(void* parent)                       {(void)parent;return now;}
+static void hw_set(void* hw,uint8_t* data,size_t len)   {(void)hw;(void)data;(void)len;}
+static void hw_nop(void* hw)                            {(void)hw;}
+static bool hw_true(void* hw)                           {(void)hw;return true;}
+static size_t hw_max(void* hw)                          {(void)hw;return 2*BENCH_FRAME;}
+
+static bool hw_send(void* hw,const uint8_t* data,size_t len)
+{
+  sBenchHw_t* peer = ((sBenchHw_t*)hw)->peer;
+
+  if(peer->cnt >= peer->depth)
+  {
+    peer->lost++;
+    return true; /* gone on the wire*/
+  }
+  memcpy(peer->fifo[peer->cnt].data,data,len);
+  peer->fifo[peer->cnt].len = len;
+  peer->fifo[peer->cnt].due = now+BENCH_DELAY;
+  peer->cnt++;
+  return true;
+}
+
+static bool hw_read(void* hw,uint8_t* data,size_t* len,size_t max_len)
+{
+  sBenchHw_t* cthis = hw;
+
+  if((cthis->cnt == 0)||((int32_t)(now-cthis->fifo[0].due) < 0)||((int32_t)(now-cthis->next) < 0))
+    return false;
+  if(cthis->fifo[0].len > max_len)
+    abort();
+
+  memcpy(data,cthis->fifo[0].data,cthis->fifo[0].len);
+  *len = cthis->fifo[0].len;
+  memmove(&cthis->fifo[0],&cthis->fifo[1],(cthis->cnt-1)*sizeof(cthis->fifo[0]));
+  cthis->cnt--;
+  cthis->next = now+cthis->period;
+  return true;
+}
+
+static void hw_init(sBenchHw_t* hw,sBenchHw_t* peer,size_t depth,uint32_t period)
+{
+  memset(hw,0,sizeof(*hw));
+  hw->vtable.SetRxBuff       = hw_set;
+  hw->vtable.SetTxBuff       = hw_set;
+  hw->vtable.EnterCriticalRx = hw_nop;
+  hw->vtable.ExitCriticalRx  = hw_nop;
+  hw->vtable.EnterCriticalTx = hw_nop;
+  hw->vtable.ExitCriticalTx  = hw_nop;
+  hw->vtable.Connect         = hw_true;
+  hw->vtable.Disconnect      = hw_true;
+  hw->vtable.Process         = hw_nop;
+  hw->vtable.IsFree          = hw_true;
+  hw->vtable.SendData        = hw_send;
+  hw->vtable.ReadRxBuff      = hw_read;
+  hw->vtable.GetMaxDataLeng  = hw_max;
+  hw->base.vtable            = &hw->vtable;
+  hw->peer                   = peer;
+  hw->depth                  = depth;
+  hw->period                 = period;
+}
+
+static void run_case(uint32_t rate,uint32_t ticks)
+{
+  static sBenchHw_t tx,rx;
+  hw_init(&tx,&rx,sizeof(tx.fifo)/sizeof(tx.fifo[0]),0);
+  hw_init(&rx,&tx,BENCH_FIFO,RX_PERIOD);
+  now = 0;
+
+  InterfaceHandel_t* it = Interface_ctor(&tx.base,2*BENCH_FRAME,64);
+  InterfaceHandel_t* ir = Interface_ctor(&rx.base,2*BENCH_FRAME,64);
+
+  sInterfaceArqCfg_t cfg = {.Window = 16,.MaxPayload = BENCH_PAYLOAD,
+                            .RtoInit = 200,.RtoMin = 20,.RtoMax = 2000,.Clock = {NULL,clk}};
+  InterfaceArq_t* qt = InterfaceArq_ctor(it,&cfg);
+  InterfaceArq_t* qr = InterfaceArq_ctor(ir,&cfg);
+  Interface_InstallArq(it,qt);
+  Interface_InstallArq(ir,qr);
+
+  if(rate)
+  {
+    sInterfaceShaper_t shaper = {.Clock = {NULL,clk},.Rate = rate,.Burst = 2*BENCH_FRAME};
+    Interface_SetShaper(it,&shaper);
+  }
+
+  uint8_t  payload[BENCH_PAYLOAD] = {0};
+  uint8_t  buf[2*BENCH_FRAME];
+  uint32_t got = 0;
+
+  for(; now < ticks; now++)
+  {
+    while(InterfaceArq_IsTxFree(qt))
+      InterfaceArq_Send(qt,payload,sizeof(payload));
+
+    Interface_process(it);
+    Interface_process(ir);
+
+    while(Interface_readData(ir,buf))
+      got++;
+    while(Interface_readData(it,buf));
+  }
+
+  sInterfaceArqStats_t st;
+  InterfaceArq_GetStats(qt,&st);
+
+  double cap = (double)BENCH_FRAME/RX_PERIOD;
+  if(rate)
+    printf("rate %4.2f x cap  ",rate/1000.0/cap);
+  else
+    printf("shaper off        ");
+  printf("goodput %6.2f B/tick (%5.1f %% of cap)  lost %6u  retx %6u  fast %6u\n",
+         (double)got*BENCH_PAYLOAD/ticks,100.0*got*BENCH_FRAME/ticks/cap,
+         rx.lost,st.Retransmits,st.FastRetransmits);
+
+  InterfaceArq_dtor(qt);
+  InterfaceArq_dtor(qr);
+  Interface_dtor(it);
+  Interface_dtor(ir);
+}
+
+int main(int argc,char** argv)
+{
+  uint32_t ticks = (argc > 1) ? (uint32_t)strtoul(argv[1],NULL,0) : 200000;
+  uint32_t cap   = 1000u*BENCH_FRAME/RX_PERIOD; /* capacity in shaper units*/
+
+  run_case(0,ticks);
+
+  static const uint32_t pct[] = {50,80,90,95,100,110,150,200};
+  for(size_t i = 0; i < sizeof(pct)/sizeof(pct[0]); i++)
+    run_case(cap*pct[i]/100,ticks);
+
+  return 0;
+}
@@ -0,0 +1,268 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceShmBench.c
+ * @author   Wyrm
+ * @brief    Two-process latency of @ref InterfaceShm_t against a unix socket
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_shm_bench [-y] [frames]
+
+  Parent and forked child each run a raw mode interface, the child echoes every
+  frame. The parent sends a frame, polls until the echo is back and records
+  round trip / 2 as one-way latency.
+  sock     - AF_UNIX SOCK_SEQPACKET pair, send()/recv() driver, busy-poll
+  shm-spin - InterfaceShm_t, fds passed by SCM_RIGHTS, busy-poll
+  shm-wait - InterfaceShm_t, idle side sleeps in InterfaceShm_Wait (eventfd)
+  -y       - sched_yield() on idle poll, for hosts with fewer than two cores
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#include "Interface.h"
+#include "InterfacePrivate.h"
+#include "InterfaceShm.h"
+
+#define BENCH_MAX_FRAME  64u
+#define BENCH_WARMUP     1000u
+
+typedef enum
+{
+  kBenchSock,
+  kBenchShmSpin,
+  kBenchShmWait,
+}eBenchMode_t;
+
+/**
+ * @brief Socket driver
+ *
+ */
+typedef struct
+{
+  HWInterface_t         base;
+  HwInterface_vtable_t  vtable;
+  int                   fd;
+}sBenchHw_t;
+
+/**
+ * @brief One side of the bench
+ *
+ */
+typedef struct
+{
+  sBenchHw_t          hw;
+  InterfaceShm_t*     shm;
+  InterfaceHandel_t*  iface;
+  bool                echo;     /*!< child: send frame back*/
+  size_t              cnt;
+}sBenchNode_t;
+
+static bool yield_idle;
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+static void hw_set(void* hw,uint8_t* data,size_t len)  {(void)hw;(void)data;(void)len;}
+static void hw_nop(void* hw)                            {(void)hw;}
+static bool hw_true(void* hw)                           {(void)hw;return true;}
+static size_t hw_max(void* hw)                          {(void)hw;return BENCH_MAX_FRAME;}
+
+static bool hw_send(void* hw,const uint8_t* data,size_t len)
+{
+  return send(((sBenchHw_t*)hw)->fd,data,len,MSG_DONTWAIT) == (ssize_t)len;
+}
+
+static bool hw_read(void* hw,uint8_t* data,size_t* len,size_t max_len)
+{
+  ssize_t ret = recv(((sBenchHw_t*)hw)->fd,data,max_len,MSG_DONTWAIT);
+
+  if(ret <= 0)
+    return false;
+  *len = (size_t)ret;
+  return true;
+}
+
+static void hw_init(sBenchHw_t* hw,int fd)
+{
+  memset(hw,0,sizeof(*hw));
+  hw->vtable.SetRxBuff       = hw_set;
+  hw->vtable.SetTxBuff       = hw_set;
+  hw->vtable.EnterCriticalRx = hw_nop;
+  hw->vtable.ExitCriticalRx  = hw_nop;
+  hw->vtable.EnterCriticalTx = hw_nop;
+  hw->vtable.ExitCriticalTx  = hw_nop;
+  hw->vtable.Connect         = hw_true;
+  hw->vtable.Disconnect      = hw_true;
+  hw->vtable.Process         = hw_nop;
+  hw->vtable.IsFree          = hw_true;
+  hw->vtable.SendData        = hw_send;
+  hw->vtable.ReadRxBuff      = hw_read;
+  hw->vtable.GetMaxDataLeng  = hw_max;
+  hw->base.vtable            = &hw->vtable;
+  hw->fd                     = fd;
+}
+
+static void node_rx(void* parent,InterfaceHandel_t* iface,uint8_t* data,size_t len)
+{
+  sBenchNode_t* node = parent;
+
+  if(node->echo)
+    Interface_SendData(iface,data,len);
+  node->cnt++;
+}
+
+static void node_none(void* parent,InterfaceHandel_t* iface) {(void)parent;(void)iface;}
+
+static void node_init(sBenchNode_t* node,HWInterface_t* hw,bool echo)
+{
+  node->iface = Interface_ctor(hw,BENCH_MAX_FRAME,16);
+  node->echo  = echo;
+  node->cnt   = 0;
+  if(node->iface == NULL)
+    exit(1);
+
+  sInterfaceIrqParentCB_t cb = {.parent = node,.RxCb = node_rx,.TxCb = node_none,.ErrCb = node_none};
+  Interface_SetRawMode(node->iface,true);
+  Interface_SetCB(node->iface,&cb);
+  Interface_SetCutThrough(node->iface,true);
+}
+
+/**
+ * @brief Poll until frame count reaches cnt
+ *
+ */
+static void node_wait(sBenchNode_t* node,eBenchMode_t mode,size_t cnt)
+{
+  while(node->cnt < cnt)
+  {
+    if(Interface_poll(node->iface))
+      continue;
+    if(mode == kBenchShmWait)
+      InterfaceShm_Wait(node->shm,100);
+    else if(yield_idle)
+      sched_yield();
+  }
+}
+
+static int cmp_u64(const void* a,const void* b)
+{
+  uint64_t x = *(const uint64_t*)a,y = *(const uint64_t*)b;
+  return (x > y)-(x < y);
+}
+
+static void run_case(const char* name,eBenchMode_t mode,size_t frames)
+{
+  int            sv[2];
+  sBenchNode_t   node;
+  size_t         total = frames+BENCH_WARMUP;
+  InterfaceShm_t* shm  = NULL;
+
+  if(socketpair(AF_UNIX,SOCK_SEQPACKET,0,sv) != 0)
+    exit(1);
+
+  if(mode != kBenchSock)
+  {
+    sInterfaceShmCfg_t cfg = {.SlotSize = BENCH_MAX_FRAME,.Deep = 64,
+                              .IdlePolls = (mode == kBenchShmWait) ? 0 : 1000};
+    if((shm = InterfaceShm_ctor(&cfg)) == NULL)
+      exit(1);
+  }
+
+  pid_t pid = fork();
+
+  if(pid == 0)
+  {
+    if(shm != NULL)
+    {
+      if((node.shm = InterfaceShm_ctorRecv(sv[1],(mode == kBenchShmWait) ? 0 : 1000)) == NULL)
+        _exit(1);
+      node_init(&node,InterfaceShm_GetHw(node.shm),true);
+    }
+    else
+    {
+      hw_init(&node.hw,sv[1]);
+      node_init(&node,&node.hw.base,true);
+    }
+    node_wait(&node,mode,total);
+    usleep(10000); /* let parent take the last echo*/
+    _exit(0);
+  }
+
+  if((shm != NULL)&&!InterfaceShm_SendFds(shm,sv[0]))
+    exit(1);
+
+  node.shm = shm;
+  if(shm != NULL)
+    node_init(&node,InterfaceShm_GetHw(shm),false);
+  else
+  {
+    hw_init(&node.hw,sv[0]);
+    node_init(&node,&node.hw.base,false);
+  }
+
+  uint64_t* lat = calloc(frames,sizeof(uint64_t));
+
+  for(size_t i = 0; i < total; i++)
+  {
+    uint8_t  frame[16] = {0};
+    uint64_t t0 = now_ns();
+
+    memcpy(frame,&i,sizeof(i));
+    while(!Interface_SendData(node.iface,frame,sizeof(frame)));
+    node_wait(&node,mode,i+1);
+    if(i >= BENCH_WARMUP)
+      lat[i-BENCH_WARMUP] = (now_ns()-t0)/2;
+  }
+
+  waitpid(pid,NULL,0);
+  qsort(lat,frames,sizeof(uint64_t),cmp_u64);
+  printf("%-8s frames %7zu  one-way p50 %7.2f us  p99 %7.2f us  max %8.1f us\n",
+         name,frames,lat[frames/2]/1e3,lat[frames*99/100]/1e3,lat[frames-1]/1e3);
+
+  free(lat);
+  Interface_dtor(node.iface);
+  InterfaceShm_dtor(shm);
+  close(sv[0]);
+  close(sv[1]);
+}
+
+int main(int argc,char** argv)
+{
+  size_t frames = 100000;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i],"-y") == 0)
+      yield_idle = true;
+    else
+      frames = strtoul(argv[i],NULL,0);
+  }
+
+  run_case("sock",kBenchSock,frames);
+  run_case("shm-spin",kBenchShmSpin,frames);
+  run_case("shm-wait",kBenchShmWait,frames);
+  return 0;
+}
@@ -0,0 +1,277 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceSimBench.c
+ * @author   Wyrm
+ * @brief    Deployment parameter sweeps on @ref InterfaceSim_t links
+ * @version  V1.0.0
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_sim_bench [seed]
+
+  Everything runs in virtual time, wall time is printed to show the speed-up.
+  window    - ARQ window over a 115200 baud radio-like link (20 ms latency,
+              2 ms jitter, BER 1e-5, error bursts, 0.5 % frame loss), 2000
+              frames of 200 bytes, goodput and retransmits per window
+  circdeep  - CircDeep of a receiver which reads its queue every 20 ms while
+              the sender bursts 64 frames at 1 Mbaud every 100 ms, rx drops
+              and tx refusals per depth
+  intbuff   - IntBuffSize of a receiver polled every 1 ms on a 1 Mbaud byte
+              stream read in 1..512 byte chunks, one read per poll, FIFO
+              overflow losses per size
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "Interface.h"
+#include "InterfaceArq.h"
+#include "InterfaceSim.h"
+
+#define BENCH_MS  1000000ull
+
+static uint64_t seed = 1;
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+static uint16_t crc16(const uint8_t* data,size_t len)
+{
+  uint16_t crc = 0xFFFF;
+
+  for(size_t i = 0; i < len; i++)
+  {
+    crc ^= data[i];
+    for(int k = 0; k < 8; k++)
+      crc = (crc & 1u) ? (uint16_t)((crc >> 1)^0xA001u) : (uint16_t)(crc >> 1);
+  }
+  return crc;
+}
+
+static size_t crc_tx(void* parent,uint8_t* dst,const uint8_t* src,size_t size,size_t dst_max)
+{
+  (void)parent;
+  if(size+2 > dst_max)
+    return 0;
+
+  uint16_t crc = crc16(src,size);
+
+  memmove(dst,src,size);
+  dst[size]   = (uint8_t)crc;
+  dst[size+1] = (uint8_t)(crc >> 8);
+  return size+2;
+}
+
+static size_t crc_rx(void* parent,uint8_t* dst,const uint8_t* src,size_t size,size_t dst_max)
+{
+  (void)parent;
+  if((size < 2)||(size-2 > dst_max)||(crc16(src,size-2) != (uint16_t)(src[size-2]|(src[size-1] << 8))))
+    return 0;
+
+  memmove(dst,src,size-2);
+  return size-2;
+}
+
+static void poll_both(InterfaceHandel_t* a,InterfaceHandel_t* b)
+{
+  while(Interface_poll(a)|Interface_poll(b));
+}
+
+static void bench_window(void)
+{
+  static const size_t windows[] = {1,2,4,8,16,32};
+  const size_t        frames    = 2000,payload = 200;
+
+  sInterfaceSimCfg_t cfg = {.MaxFrame = 256,.Deep = 64,.TickNs = BENCH_MS,.Seed = seed};
+
+  cfg.Path[0] = (sInterfaceSimPathCfg_t){.Baud = 115200,.LatencyNs = 20*BENCH_MS,.JitterNs = 2*BENCH_MS,
+                                         .Ber = 1e-5,.DropRate = 0.005,
+                                         .BurstRate = 1e-6,.BurstBits = 200,.BurstBer = 0.1};
+  cfg.Path[1] = cfg.Path[0];
+
+  printf("window: 115200 baud, 20 ms, BER 1e-5 + bursts, 0.5%% loss, %zu x %zu B\n",frames,payload);
+
+  for(size_t w = 0; w < sizeof(windows)/sizeof(windows[0]); w++)
+  {
+    InterfaceSim_t*    sim = InterfaceSim_ctor(&cfg);
+    InterfaceHandel_t* a   = Interface_ctor(InterfaceSim_GetHw(sim,0),256,64);
+    InterfaceHandel_t* b   = Interface_ctor(InterfaceSim_GetHw(sim,1),256,64);
+    sInterfaceStage_t  crc = {.parent = NULL,.Tx = crc_tx,.Rx = crc_rx,.Overhead = 2,.InPlace = true};
+    sInterfaceArqCfg_t acfg = {.Window = windows[w],.MaxPayload = payload,.RtoInit = 200,.RtoMin = 50,.RtoMax = 2000,
+                               .Clock = {.parent = sim,.func = InterfaceSim_Tick}};
+
+    Interface_AddStage(a,&crc);
+    Interface_AddStage(b,&crc);
+    InterfaceArq_t* qa = InterfaceArq_ctor(a,&acfg);
+    InterfaceArq_t* qb = InterfaceArq_ctor(b,&acfg);
+    Interface_InstallArq(a,qa);
+    Interface_InstallArq(b,qb);
+
+    size_t   sent = 0,got = 0;
+    uint8_t  buf[256];
+    uint64_t wall = now_ns();
+
+    while((got < frames)&&(InterfaceSim_Now(sim) < 3600000*BENCH_MS))
+    {
+      while((sent < frames)&&InterfaceArq_IsTxFree(qa))
+      {
+        memset(buf,(int)sent,payload);
+        InterfaceArq_Send(qa,buf,payload);
+        sent++;
+      }
+      poll_both(a,b);
+      while(Interface_readData(b,buf) != 0)
+        got++;
+      while(Interface_readData(a,buf) != 0);
+      InterfaceSim_Advance(sim,BENCH_MS);
+    }
+    wall = now_ns()-wall;
+
+    sInterfaceArqStats_t ast;
+    sInterfaceSimStats_t sst;
+    double               vs = (double)InterfaceSim_Now(sim)/1e9;
+
+    InterfaceArq_GetStats(qa,&ast);
+    InterfaceSim_GetStats(sim,0,&sst);
+    printf("  window %2zu  %4zu frames  %8.2f s  goodput %7.0f B/s  (%4.1f %% of line)  retx %4u fast %4u  corrupt %4llu  wall %6.1f ms  x%.0f\n",
+           windows[w],got,vs,(double)(got*payload)/vs,100.0*(double)(got*payload)/vs/(115200/10),
+           ast.Retransmits,ast.FastRetransmits,(unsigned long long)sst.Corrupted,wall/1e6,vs*1e9/(double)wall);
+
+    Interface_dtor(a);
+    Interface_dtor(b);
+    InterfaceArq_dtor(qa);
+    InterfaceArq_dtor(qb);
+    InterfaceSim_dtor(sim);
+  }
+}
+
+static void bench_circdeep(void)
+{
+  static const size_t deeps[] = {4,8,16,32,64};
+  const size_t        bursts  = 200,burst = 64,leng = 64;
+
+  sInterfaceSimCfg_t cfg = {.MaxFrame = 128,.Deep = 128,.TickNs = BENCH_MS,.Seed = seed};
+
+  cfg.Path[0] = (sInterfaceSimPathCfg_t){.Baud = 1000000,.LatencyNs = BENCH_MS};
+  cfg.Path[1] = cfg.Path[0];
+
+  printf("circdeep: 1 Mbaud, burst %zu x %zu B every 100 ms, reader every 20 ms\n",burst,leng);
+
+  for(size_t d = 0; d < sizeof(deeps)/sizeof(deeps[0]); d++)
+  {
+    InterfaceSim_t*    sim = InterfaceSim_ctor(&cfg);
+    InterfaceHandel_t* a   = Interface_ctor(InterfaceSim_GetHw(sim,0),128,deeps[d]);
+    InterfaceHandel_t* b   = Interface_ctor(InterfaceSim_GetHw(sim,1),128,deeps[d]);
+    uint8_t            buf[128] = {0};
+    size_t             refused = 0,got = 0;
+
+    Interface_SetRawMode(a,true);
+    Interface_SetRawMode(b,true);
+
+    for(uint64_t ms = 0; ms < bursts*100; ms++)
+    {
+      if(ms%100 == 0)
+        for(size_t i = 0; i < burst; i++)
+          refused += !Interface_SendData(a,buf,leng);
+
+      /* step the link through the whole millisecond, polls at every event*/
+      uint64_t end = (ms+1)*BENCH_MS;
+      do
+        poll_both(a,b);
+      while(InterfaceSim_Advance(sim,end-InterfaceSim_Now(sim)) != 0);
+
+      if(ms%20 == 19)
+        while(Interface_readData(b,buf) != 0)
+          got++;
+    }
+
+    sInterfaceRxDrops_t drops;
+    Interface_GetRxDrops(b,&drops);
+    printf("  CircDeep %2zu  sent %5zu  tx refused %5zu (%5.1f %%)  rx %5zu  rx dropped %5u (%5.1f %%)\n",
+           deeps[d],bursts*burst-refused,refused,100.0*(double)refused/(double)(bursts*burst),
+           got,drops.Dropped,100.0*drops.Dropped/(double)(bursts*burst-refused));
+
+    Interface_dtor(a);
+    Interface_dtor(b);
+    InterfaceSim_dtor(sim);
+  }
+}
+
+static void bench_intbuff(void)
+{
+  static const size_t sizes[] = {32,64,128,256,512};
+  const uint64_t      run_ms  = 10000;
+
+  sInterfaceSimCfg_t cfg = {.MaxFrame = 64,.Deep = 256,.TickNs = BENCH_MS,.Seed = seed};
+
+  cfg.Path[0] = (sInterfaceSimPathCfg_t){.Baud = 1000000,.LatencyNs = 100000,.ChunkMin = 1,.ChunkMax = 512};
+  cfg.Path[1] = cfg.Path[0];
+
+  printf("intbuff: 1 Mbaud stream of 64 B frames, 1..512 B chunks, poll every 1 ms\n");
+
+  for(size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++)
+  {
+    InterfaceSim_t*    sim = InterfaceSim_ctor(&cfg);
+    HWInterface_t*     tx  = InterfaceSim_GetHw(sim,0);
+    InterfaceHandel_t* b   = Interface_ctor(InterfaceSim_GetHw(sim,1),sizes[s],16);
+    uint8_t            frame[64] = {0};
+    size_t             bytes = 0;
+    uint8_t            buf[512];
+
+    Interface_SetRawMode(b,true);
+
+    /* sender keeps the wire busy, receiver polls once per ms*/
+    for(uint64_t ms = 0; ms < run_ms; ms++)
+    {
+      uint64_t end = (ms+1)*BENCH_MS;
+
+      while(InterfaceSim_Now(sim) < end)
+      {
+        tx->vtable->SendData(tx,frame,sizeof(frame));
+        InterfaceSim_Advance(sim,end-InterfaceSim_Now(sim));
+      }
+      Interface_poll(b);
+      size_t l;
+      while((l = Interface_readData(b,buf)) != 0)
+        bytes += l;
+    }
+
+    sInterfaceSimStats_t st;
+    InterfaceSim_GetStats(sim,0,&st);
+    printf("  IntBuffSize %3zu  read %8.0f B/s of %8.0f  FIFO overflow %6llu frames (%5.1f %%)\n",
+           sizes[s],(double)bytes*1000.0/(double)run_ms,(double)st.TxBytes*1000.0/(double)run_ms,
+           (unsigned long long)st.Overflows,100.0*(double)st.Overflows/(double)st.TxFrames);
+
+    Interface_dtor(b);
+    InterfaceSim_dtor(sim);
+  }
+}
+
+int main(int argc,char** argv)
+{
+  if(argc > 1)
+    seed = strtoull(argv[1],NULL,0);
+
+  bench_window();
+  bench_circdeep();
+  bench_intbuff();
+
+  return 0;
+}
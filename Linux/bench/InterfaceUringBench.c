@@ -0,0 +1,321 @@
+/**
+ ****************************************************************************
+ * @file     InterfaceUringBench.c
+ * @author   Wyrm
+ * @brief    Frames/s per core of @ref InterfaceUring_t against plain send/recv
+ * @version  V1.0.1
+ * @date     19 Oct. 2026.
+
+ *************************************************************************
+ */
+/*
+   @verbatim
+  ==============================================================================
+                        ##### How to use this bench #####
+  ==============================================================================
+  interface_uring_bench [frames]
+
+  Two raw mode interfaces over an AF_UNIX SOCK_SEQPACKET pair, both polled in
+  one thread. Frames of 16..256 bytes are sent in bursts and checked on rx.
+  sock   - non-blocking send()/recv() driver, one syscall per call
+  uring  - InterfaceUring_t, RxDepth 64, TxSlots 64
+  sqpoll - uring with SqPollMs 10, only with a spare cpu for the SQ thread
+  Every case reports syscalls per frame, frames per cpu second and cpu time
+  per frame split in user and kernel time.
+  idle   - Interface_poll of an interface with nothing to read or send, cpu
+           time per poll
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/resource.h>
+
+#include "Interface.h"
+#include "InterfacePrivate.h"
+#include "InterfaceUring.h"
+
+#define BENCH_MAX_FRAME  256u
+
+/**
+ * @brief Socket driver
+ *
+ */
+typedef struct
+{
+  HWInterface_t         base;
+  HwInterface_vtable_t  vtable;
+  int                   fd;
+  uint64_t              Syscalls;
+}sBenchHw_t;
+
+typedef struct
+{
+  size_t  cnt;      /*!< frames received*/
+  size_t  bad;      /*!< frames not matching sent pattern*/
+}sBenchRx_t;
+
+static uint64_t now_ns(clockid_t clk)
+{
+  struct timespec ts;
+  clock_gettime(clk,&ts);
+  return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+static uint64_t tv_ns(const struct timeval* tv)
+{
+  return (uint64_t)tv->tv_sec*1000000000u+(uint64_t)tv->tv_usec*1000u;
+}
+
+static void hw_set(void* hw,uint8_t* data,size_t len)  {(void)hw;(void)data;(void)len;}
+static void hw_nop(void* hw)                            {(void)hw;}
+static bool hw_true(void* hw)                           {(void)hw;return true;}
+static size_t hw_max(void* hw)                          {(void)hw;return BENCH_MAX_FRAME;}
+
+static bool hw_send(void* hw,const uint8_t* data,size_t len)
+{
+  sBenchHw_t* cthis = hw;
+
+  cthis->Syscalls++;
+  return send(cthis->fd,data,len,MSG_DONTWAIT) == (ssize_t)len;
+}
+
+static bool hw_read(void* hw,uint8_t* data,size_t* len,size_t max_len)
+{
+  sBenchHw_t* cthis = hw;
+  ssize_t     ret;
+
+  cthis->Syscalls++;
+  if((ret = recv(cthis->fd,data,max_len,MSG_DONTWAIT)) <= 0)
+    return false;
+  *len = (size_t)ret;
+  return true;
+}
+
+static void hw_init(sBenchHw_t* hw,int fd)
+{
+  memset(hw,0,sizeof(*hw));
+  hw->vtable.SetRxBuff       = hw_set;
+  hw->vtable.SetTxBuff       = hw_set;
+  hw->vtable.EnterCriticalRx = hw_nop;
+  hw->vtable.ExitCriticalRx  = hw_nop;
+  hw->vtable.EnterCriticalTx = hw_nop;
+  hw->vtable.ExitCriticalTx  = hw_nop;
+  hw->vtable.Connect         = hw_true;
+  hw->vtable.Disconnect      = hw_true;
+  hw->vtable.Process         = hw_nop;
+  hw->vtable.IsFree          = hw_true;
+  hw->vtable.SendData        = hw_send;
+  hw->vtable.ReadRxBuff      = hw_read;
+  hw->vtable.GetMaxDataLeng  = hw_max;
+  hw->base.vtable            = &hw->vtable;
+  hw->fd                     = fd;
+}
+
+static size_t make_frame(uint8_t* buf,size_t seq)
+{
+  size_t len = 16+seq%(BENCH_MAX_FRAME-15);
+
+  for(size_t i = 0; i < len; i++)
+    buf[i] = (uint8_t)(seq+i);
+  return len;
+}
+
+static void node_rx(void* parent,InterfaceHandel_t* iface,uint8_t* data,size_t len)
+{
+  sBenchRx_t* rx = parent;
+  uint8_t     ref[BENCH_MAX_FRAME];
+
+  (void)iface;
+  if((make_frame(ref,rx->cnt) != len)||(memcmp(ref,data,len) != 0))
+    rx->bad++;
+  rx->cnt++;
+}
+
+static void node_none(void* parent,InterfaceHandel_t* iface) {(void)parent;(void)iface;}
+
+/**
+ * @brief Open driver on one end of a socketpair
+ *
+ * @param hw      socket driver storage
+ * @param ur      io_uring driver, NULL - socket driver
+ * @param fd      socket
+ * @param sqpoll  SqPollMs of io_uring driver
+ * @return driver
+ */
+static HWInterface_t* hw_open(sBenchHw_t* hw,InterfaceUring_t** ur,int fd,uint32_t sqpoll)
+{
+  sInterfaceUringCfg_t cfg = {.MaxFrame = BENCH_MAX_FRAME,.RxDepth = 64,.TxSlots = 64,.SqPollMs = sqpoll};
+
+  if(ur == NULL)
+  {
+    hw_init(hw,fd);
+    return &hw->base;
+  }
+
+  if((*ur = InterfaceUring_ctorFd(fd,&cfg)) == NULL)
+  {
+    printf("io_uring not available\n");
+    exit(1);
+  }
+  return InterfaceUring_GetHw(*ur);
+}
+
+static void run_case(bool uring,uint32_t sqpoll,size_t burst,size_t frames)
+{
+  int sv[2];
+
+  if(socketpair(AF_UNIX,SOCK_SEQPACKET,0,sv) != 0)
+    exit(1);
+
+  sBenchHw_t        hw[2];
+  InterfaceUring_t* ur[2] = {NULL,NULL};
+  HWInterface_t*    base[2];
+
+  for(int i = 0; i < 2; i++)
+    base[i] = hw_open(&hw[i],uring ? &ur[i] : NULL,sv[i],sqpoll);
+
+  InterfaceHandel_t* tx = Interface_ctor(base[0],BENCH_MAX_FRAME,256);
+  InterfaceHandel_t* rx = Interface_ctor(base[1],BENCH_MAX_FRAME,256);
+  sBenchRx_t         got = {0};
+
+  if((tx == NULL)||(rx == NULL))
+    exit(1);
+
+  sInterfaceIrqParentCB_t cb = {.parent = &got,.RxCb = node_rx,.TxCb = node_none,.ErrCb = node_none};
+  Interface_SetRawMode(tx,true);
+  Interface_SetRawMode(rx,true);
+  Interface_SetCB(rx,&cb);
+  Interface_SetCutThrough(rx,true);
+
+  struct rusage ru0,ru1;
+
+  getrusage(RUSAGE_SELF,&ru0);
+
+  uint64_t t0   = now_ns(CLOCK_MONOTONIC);
+  uint64_t c0   = now_ns(CLOCK_PROCESS_CPUTIME_ID);
+  size_t   sent = 0;
+
+  while(got.cnt < frames)
+  {
+    for(size_t i = 0; (i < burst)&&(sent < frames); i++)
+    {
+      uint8_t buf[BENCH_MAX_FRAME];
+      size_t  len = make_frame(buf,sent);
+
+      if(!Interface_SendData(tx,buf,len))
+        break;
+      sent++;
+    }
+
+    uint64_t limit = now_ns(CLOCK_MONOTONIC)+1000000000u;
+    while((got.cnt < sent)&&(now_ns(CLOCK_MONOTONIC) < limit))
+    {
+      Interface_poll(tx);
+      Interface_poll(rx);
+    }
+    if(got.cnt < sent)
+    {
+      printf("timeout, %zu of %zu frames\n",got.cnt,sent);
+      break;
+    }
+  }
+
+  uint64_t dt  = now_ns(CLOCK_MONOTONIC)-t0;
+  uint64_t cpu = now_ns(CLOCK_PROCESS_CPUTIME_ID)-c0;
+  uint64_t sys = 0;
+
+  getrusage(RUSAGE_SELF,&ru1);
+
+  for(int i = 0; i < 2; i++)
+  {
+    if(uring)
+    {
+      sInterfaceUringStats_t st;
+      InterfaceUring_GetStats(ur[i],&st);
+      sys += st.Enters;
+    }
+    else
+      sys += hw[i].Syscalls;
+  }
+
+  printf("%-6s burst %3zu  frames %7zu  bad %zu  syscalls/frame %6.3f  %9.0f frames/s  %9.0f frames/cpu s  user %4.0f kernel %4.0f ns/frame\n",
+         !uring ? "sock" : (sqpoll != 0) ? "sqpoll" : "uring",burst,got.cnt,got.bad,(double)sys/(double)frames,
+         (double)got.cnt*1e9/(double)dt,(double)got.cnt*1e9/(double)cpu,
+         (double)(tv_ns(&ru1.ru_utime)-tv_ns(&ru0.ru_utime))/(double)frames,
+         (double)(tv_ns(&ru1.ru_stime)-tv_ns(&ru0.ru_stime))/(double)frames);
+
+  Interface_dtor(tx);
+  Interface_dtor(rx);
+  for(int i = 0; i < 2; i++)
+  {
+    if(uring)
+      InterfaceUring_dtor(ur[i]);
+    else
+      close(sv[i]);
+  }
+}
+
+static void idle_case(bool uring,size_t polls)
+{
+  int sv[2];
+
+  if(socketpair(AF_UNIX,SOCK_SEQPACKET,0,sv) != 0)
+    exit(1);
+
+  sBenchHw_t         hw;
+  InterfaceUring_t*  ur    = NULL;
+  InterfaceHandel_t* iface = Interface_ctor(hw_open(&hw,uring ? &ur : NULL,sv[0],0),BENCH_MAX_FRAME,256);
+
+  if(iface == NULL)
+    exit(1);
+  Interface_SetRawMode(iface,true);
+
+  uint64_t c0 = now_ns(CLOCK_PROCESS_CPUTIME_ID);
+  for(size_t i = 0; i < polls; i++)
+    Interface_poll(iface);
+  uint64_t cpu = now_ns(CLOCK_PROCESS_CPUTIME_ID)-c0;
+
+  printf("idle   %-6s %7.1f ns/poll\n",uring ? "uring" : "sock",(double)cpu/(double)polls);
+
+  Interface_dtor(iface);
+  if(uring)
+    InterfaceUring_dtor(ur);
+  else
+    close(sv[0]);
+  close(sv[1]);
+}
+
+int main(int argc,char** argv)
+{
+  size_t frames = (argc > 1) ? strtoul(argv[1],NULL,0) : 200000;
+  static const size_t bursts[] = {1,16,64};
+
+  for(size_t i = 0; i < sizeof(bursts)/sizeof(bursts[0]); i++)
+  {
+    run_case(false,0,bursts[i],frames);
+    run_case(true,0,bursts[i],frames);
+  }
+
+  /* SQ thread and this loop on one cpu take turns per time slice*/
+  if(sysconf(_SC_NPROCESSORS_ONLN) > 1)
+  {
+    for(size_t i = 1; i < sizeof(bursts)/sizeof(bursts[0]); i++)
+      run_case(true,10,bursts[i],frames);
+  }
+  else
+    printf("sqpoll skipped, SQ thread needs a spare cpu\n");
+
+  idle_case(false,1000000);
+  idle_case(true,1000000);
+
+  return 0;
+}